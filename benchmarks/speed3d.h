@@ -336,6 +336,8 @@ int main(int argc, char *argv[]){
                  << "         -a2av: use MPI_Alltoallv() communication method (default)\n"
                  << "         -p2p: use MPI_Send() and MPI_Irecv() communication methods\n"
                  << "         -p2p_pl: use MPI_Isend() and MPI_Irecv() communication methods\n"
+                 << "         -na2av: use MPI_Neighbor_alltoallv() over a graph communicator\n"
+                 << "         -shmem: use a shared memory window for the intra-node messages (cpu backends)\n"
                  << "         -no-gpu-aware: move the data to the cpu before doing gpu operations (gpu backends only)\n"
                  << "         -pencils: use pencil reshape logic\n"
                  << "         -slabs: use slab reshape logic\n"
@@ -13,6 +13,7 @@
 
 #include <cuda_runtime_api.h>
 #include <cuda.h>
+#include <cuda_fp16.h>
 #include <cufft.h>
 #include "heffte_backend_vector.h"
 
@@ -74,6 +75,22 @@ namespace cuda {
      */
     template<typename precision_type, typename index>
     void convert(cudaStream_t stream, index num_entries, std::complex<precision_type> const source[], precision_type destination[]);
+    /*!
+     * \ingroup hefftecuda
+     * \brief Convert half precision numbers to single precision when both are located on the GPU device.
+     *
+     * Launches a CUDA kernel.
+     */
+    template<typename index>
+    void convert(cudaStream_t stream, index num_entries, __half const source[], float destination[]);
+    /*!
+     * \ingroup hefftecuda
+     * \brief Convert single precision numbers to half precision when both are located on the GPU device.
+     *
+     * Launches a CUDA kernel.
+     */
+    template<typename index>
+    void convert(cudaStream_t stream, index num_entries, float const source[], __half destination[]);
 
     /*!
      * \ingroup hefftecuda
@@ -798,6 +815,8 @@ template<> struct one_dim_backend<backend::cufft_cos1>{
  * \brief Simple packer that copies sub-boxes without transposing the order of the indexes.
  */
 template<> struct direct_packer<tag::gpu>{
+    //! \brief Constructor, the non-temporal mode is a no-op on the GPU.
+    direct_packer(bool = false){}
     //! \brief Execute the planned pack operation.
     template<typename scalar_type, typename index>
     void pack(cudaStream_t stream, pack_plan_3d<index> const &plan, scalar_type const data[], scalar_type buffer[]) const{
@@ -815,6 +834,8 @@ template<> struct direct_packer<tag::gpu>{
  * \brief GPU version of the transpose packer.
  */
 template<> struct transpose_packer<tag::gpu>{
+    //! \brief Constructor, the non-temporal mode is a no-op on the GPU.
+    transpose_packer(bool = false){}
     //! \brief Execute the planned pack operation.
     template<typename scalar_type, typename index>
     void pack(cudaStream_t stream, pack_plan_3d<index> const &plan, scalar_type const data[], scalar_type buffer[]) const{
@@ -0,0 +1,230 @@
+/*
+    -- heFFTe --
+       Univ. of Tennessee, Knoxville
+       @date
+*/
+
+#ifndef HEFFTE_BACKEND_CUFFTMP_H
+#define HEFFTE_BACKEND_CUFFTMP_H
+
+#include "heffte_backend_cuda.h"
+
+#ifdef Heffte_ENABLE_CUFFTMP
+
+#include <cufftMp.h>
+
+/*!
+ * \ingroup fft3d
+ * \addtogroup hefftecufftmp Backend cufftmp
+ *
+ * Wrappers and template specializations related to the cuFFTMp backend.
+ * Requires CMake options:
+ * \code
+ *  -D Heffte_ENABLE_CUDA=ON
+ *  -D Heffte_ENABLE_CUFFTMP=ON
+ * \endcode
+ *
+ * Unlike the other backends, cuFFTMp performs the pencil/slab transposes internally
+ * using NVSHMEM one-sided communication, i.e., the heFFTe reshape operations are
+ * skipped and a single executor spans the entire distributed transform.
+ */
+
+namespace heffte{
+
+namespace backend{
+    /*!
+     * \ingroup hefftecufftmp
+     * \brief Indicate that the cuFFTMp backend has been enabled.
+     */
+    template<> struct is_enabled<cufftmp> : std::true_type{};
+
+    /*!
+     * \ingroup hefftecufftmp
+     * \brief Defines the location type-tag and the cuda container.
+     */
+    template<>
+    struct buffer_traits<cufftmp>{
+        //! \brief The cuFFTMp library uses data on the gpu device.
+        using location = tag::gpu;
+        //! \brief The data is managed by the cuda vector container.
+        template<typename T> using container = heffte::gpu::device_vector<T, data_manipulator<tag::gpu>>;
+    };
+
+    /*!
+     * \ingroup hefftecufftmp
+     * \brief The cuFFTMp library handles the inter-rank communication inside the plan.
+     */
+    template<> struct uses_internal_reshape<cufftmp> : std::true_type{};
+}
+
+/*!
+ * \ingroup hefftecufftmp
+ * \brief Wrapper around a distributed cufftHandle, r2c single and double precision case.
+ *
+ * The MPI communicator is attached to the plan and the pencil/slab communication
+ * is delegated to the NVSHMEM-based transpose inside cuFFTMp.
+ *
+ * \tparam scalar_type must be float or double
+ */
+template<typename scalar_type> struct plan_cufftmp_r2c{
+    /*!
+     * \brief Constructor, makes a distributed 3D plan over the given communicator.
+     *
+     * \param stream is the CUDA stream to use for the transform
+     * \param comm is the communicator with all ranks participating in the transform
+     * \param dir is the direction (forward or backward) for the plan
+     * \param size1 is the number of entries in the fast (contiguous) direction of the world box
+     * \param size2 is the number of entries in the middle direction of the world box
+     * \param size3 is the number of entries in the slow direction of the world box
+     */
+    plan_cufftmp_r2c(cudaStream_t stream, MPI_Comm comm, direction dir, int size1, int size2, int size3) : comm_(comm){
+        static_assert(std::is_same<scalar_type, float>::value or std::is_same<scalar_type, double>::value,
+                      "plan_cufftmp_r2c can be used only with scalar_type float or double.");
+
+        size_t work_size = 0;
+        cuda::check_error(cufftCreate(&plan), "plan_cufftmp_r2c::cufftCreate()");
+        if (stream != nullptr)
+            cuda::check_error(cufftSetStream(plan, stream), "cufftSetStream()");
+        cuda::check_error(cufftMpAttachComm(plan, CUFFT_COMM_MPI, &comm_), "plan_cufftmp_r2c::cufftMpAttachComm()");
+        cuda::check_error(
+                cufftMpMakePlan3d(plan, size3, size2, size1,
+                                  (std::is_same<scalar_type, float>::value) ?
+                                        (dir == direction::forward) ? CUFFT_R2C : CUFFT_C2R
+                                      : (dir == direction::forward) ? CUFFT_D2Z : CUFFT_Z2D,
+                                  &work_size),
+                "plan_cufftmp_r2c::cufftMpMakePlan3d()"
+            );
+    }
+    //! \brief Destructor, deletes the plan.
+    ~plan_cufftmp_r2c(){ cufftDestroy(plan); }
+    //! \brief Custom conversion to the cufftHandle.
+    operator cufftHandle() const{ return plan; }
+
+private:
+    //! \brief The communicator must persist for the lifetime of the plan.
+    MPI_Comm comm_;
+    //! \brief The cufft opaque structure (pointer to struct).
+    cufftHandle plan;
+};
+
+/*!
+ * \ingroup hefftecufftmp
+ * \brief Wrapper to the distributed real-to-complex transform of the cuFFTMp API.
+ *
+ * Serves the purpose of heffte::cufft_executor_r2c but spans the entire world box,
+ * i.e., a single call to forward() or backward() computes the full three dimensional
+ * transform including all inter-rank transposes.
+ * The local data is wrapped in a cudaLibXtDesc descriptor with CUFFT_XT_FORMAT_INPLACE,
+ * which maps the natural slab decomposition of the inbox to the cuFFTMp data distribution.
+ * All real arrays must have size box_size() and all complex arrays must have size complex_size().
+ */
+class cufftmp_executor_r2c : public executor_base{
+public:
+    //! \brief Bring forth method that have not been overloaded.
+    using executor_base::forward;
+    //! \brief Bring forth method that have not been overloaded.
+    using executor_base::backward;
+    /*!
+     * \brief Constructor, defines the global transform and the local sub-boxes.
+     *
+     * \param active_stream is the CUDA stream to use for the transform
+     * \param comm is the communicator with all ranks participating in the transform
+     * \param world is the box describing the entire global domain
+     * \param inbox is the local box holding the real data
+     * \param outbox is the local box holding the complex coefficients
+     */
+    template<typename index>
+    cufftmp_executor_r2c(cudaStream_t active_stream, MPI_Comm comm, box3d<index> const world,
+                         box3d<index> const inbox, box3d<index> const outbox) :
+        stream(active_stream), comm_(comm),
+        world_size({static_cast<int>(world.size[0]), static_cast<int>(world.size[1]), static_cast<int>(world.size[2])}),
+        rsize(inbox.count()), csize(outbox.count())
+    {}
+
+    //! \brief Forward transform, single precision.
+    void forward(float const indata[], std::complex<float> outdata[], std::complex<float>*) const override{
+        make_plan(sforward, direction::forward);
+        apply(*sforward, const_cast<float*>(indata), outdata, CUFFT_FORWARD);
+    }
+    //! \brief Backward transform, single precision.
+    void backward(std::complex<float> indata[], float outdata[], std::complex<float>*) const override{
+        make_plan(sbackward, direction::backward);
+        apply(*sbackward, indata, outdata, CUFFT_INVERSE);
+    }
+    //! \brief Forward transform, double precision.
+    void forward(double const indata[], std::complex<double> outdata[], std::complex<double>*) const override{
+        make_plan(dforward, direction::forward);
+        apply(*dforward, const_cast<double*>(indata), outdata, CUFFT_FORWARD);
+    }
+    //! \brief Backward transform, double precision.
+    void backward(std::complex<double> indata[], double outdata[], std::complex<double>*) const override{
+        make_plan(dbackward, direction::backward);
+        apply(*dbackward, indata, outdata, CUFFT_INVERSE);
+    }
+
+    //! \brief Returns the size of the local box with real data.
+    int box_size() const override{ return rsize; }
+    //! \brief Returns the size of the local box with complex coefficients.
+    int complex_size() const override{ return csize; }
+    //! \brief The cuFFTMp workspace is managed inside the library plan.
+    size_t workspace_size() const override{ return 0; }
+
+private:
+    //! \brief Round-trip through a cuFFTMp descriptor, the transpose logic is internal to cufftXtExecDescriptor().
+    template<typename input_type, typename output_type>
+    void apply(cufftHandle plan, input_type *indata, output_type *outdata, int cufft_dir) const{
+        cudaLibXtDesc *desc = nullptr;
+        cuda::check_error(cufftXtMalloc(plan, &desc, CUFFT_XT_FORMAT_INPLACE), "cufftmp_executor_r2c::cufftXtMalloc()");
+        cuda::check_error(cufftXtMemcpy(plan, desc, reinterpret_cast<void*>(indata), CUFFT_COPY_DEVICE_TO_DEVICE),
+                          "cufftmp_executor_r2c::cufftXtMemcpy() (stage in)");
+        cuda::check_error(cufftXtExecDescriptor(plan, desc, desc, cufft_dir), "cufftmp_executor_r2c::cufftXtExecDescriptor()");
+        cuda::check_error(cufftXtMemcpy(plan, reinterpret_cast<void*>(outdata), desc, CUFFT_COPY_DEVICE_TO_DEVICE),
+                          "cufftmp_executor_r2c::cufftXtMemcpy() (stage out)");
+        cuda::check_error(cufftXtFree(desc), "cufftmp_executor_r2c::cufftXtFree()");
+    }
+    //! \brief Helper template to initialize the plan.
+    template<typename scalar_type>
+    void make_plan(std::unique_ptr<plan_cufftmp_r2c<scalar_type>> &plan, direction dir) const{
+        if (!plan) plan = std::unique_ptr<plan_cufftmp_r2c<scalar_type>>(
+                        new plan_cufftmp_r2c<scalar_type>(stream, comm_, dir, world_size[0], world_size[1], world_size[2]));
+    }
+
+    mutable cudaStream_t stream;
+    MPI_Comm comm_;
+
+    std::array<int, 3> world_size;
+    int rsize, csize;
+    mutable std::unique_ptr<plan_cufftmp_r2c<float>> sforward;
+    mutable std::unique_ptr<plan_cufftmp_r2c<double>> dforward;
+    mutable std::unique_ptr<plan_cufftmp_r2c<float>> sbackward;
+    mutable std::unique_ptr<plan_cufftmp_r2c<double>> dbackward;
+};
+
+/*!
+ * \ingroup hefftecufftmp
+ * \brief Helper struct that defines the types and creates instances of one-dimensional executors.
+ *
+ * The cuFFTMp executors span the entire transform, the complex-to-complex stages
+ * are folded into the distributed r2c executor.
+ */
+template<> struct one_dim_backend<backend::cufftmp>{
+    //! \brief The c2c stages are part of the distributed r2c executor.
+    using executor = void;
+    //! \brief Defines the distributed real-to-complex executor.
+    using executor_r2c = cufftmp_executor_r2c;
+};
+
+/*!
+ * \ingroup hefftecufftmp
+ * \brief Sets the default options for the cufftmp backend.
+ */
+template<> struct default_plan_options<backend::cufftmp>{
+    //! \brief The reshape operations are internal to the library, no transpose is performed by heFFTe.
+    static const bool use_reorder = false;
+};
+
+}
+
+#endif
+
+#endif   /* HEFFTE_BACKEND_CUFFTMP_H */
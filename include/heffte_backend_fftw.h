@@ -89,6 +89,11 @@ template<> struct is_zcomplex<fftw_complex> : std::true_type{};
  * FFTW3 library uses plans for forward and backward fft transforms.
  * The specializations to this struct will wrap around such plans and provide RAII style
  * of memory management and simple constructors that take inputs suitable to HeFFTe.
+ *
+ * The plans are created once (without data arrays) and later applied to the user
+ * and scratch buffers through the new-array execute interface, e.g., fftw_execute_dft().
+ * The FFTW_UNALIGNED flag is required to make this valid for buffers of arbitrary
+ * alignment, since HeFFTe cannot control the alignment of the user provided arrays.
  */
 template<typename, direction> struct plan_fftw{};
 
@@ -111,9 +116,28 @@ struct plan_fftw<std::complex<float>, dir>{
     plan_fftw(int size, int howmanyffts, int stride, int dist) :
         plan(fftwf_plan_many_dft(1, &size, howmanyffts, nullptr, nullptr, stride, dist,
                                                     nullptr, nullptr, stride, dist,
-                                                    (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE
+                                                    (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE | FFTW_UNALIGNED
                                 ))
         {}
+    /*!
+     * \brief Constructor, merges the loop over the blocks of 1-D transforms into the plan.
+     *
+     * Describes all 1-D transforms of a box in the middle (second fastest) dimension,
+     * which form a batch with two strides and hence require the guru interface.
+     *
+     * \param size is the number of entries in a 1-D transform
+     * \param howmanyffts is the number of transforms in a single block
+     * \param stride is the distance between entries of the same transform
+     * \param dist is the distance between the first entries of consecutive sequences
+     * \param blocks is the number of blocks of transforms, i.e., the slow dimension of the batch
+     * \param block_stride is the distance between the first entries of consecutive blocks
+     */
+    plan_fftw(int size, int howmanyffts, int stride, int dist, int blocks, int block_stride){
+        fftwf_iodim fft_dim = {size, stride, stride};
+        std::array<fftwf_iodim, 2> batch_dims = {{{howmanyffts, dist, dist}, {blocks, block_stride, block_stride}}};
+        plan = fftwf_plan_guru_dft(1, &fft_dim, 2, batch_dims.data(), nullptr, nullptr,
+                                   (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE | FFTW_UNALIGNED);
+    }
     /*!
      * \brief Constructor, takes inputs identical to fftwf_plan_many_dft().
      *
@@ -130,12 +154,12 @@ struct plan_fftw<std::complex<float>, dir>{
         if (embed[0] == 0 and embed[1] == 0){
             plan = fftwf_plan_many_dft(2, size.data(), howmanyffts, nullptr, nullptr, stride, dist,
                                                     nullptr, nullptr, stride, dist,
-                                                    (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE
+                                                    (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE | FFTW_UNALIGNED
                                       );
         }else{
             plan = fftwf_plan_many_dft(2, size.data(), howmanyffts, nullptr, embed.data(), stride, dist,
                                                     nullptr, embed.data(), stride, dist,
-                                                    (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE
+                                                    (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE | FFTW_UNALIGNED
                                       );
         }
     }
@@ -143,7 +167,7 @@ struct plan_fftw<std::complex<float>, dir>{
     plan_fftw(int size1, int size2, int size3){
         std::array<int, 3> size = {size3, size2, size1};
         plan = fftwf_plan_many_dft(3, size.data(), 1, nullptr, nullptr, 1, 1, nullptr, nullptr, 1, 1,
-                                   (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE);
+                                   (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE | FFTW_UNALIGNED);
     }
     //! \brief Destructor, deletes the plan.
     ~plan_fftw(){ fftwf_destroy_plan(plan); }
@@ -162,22 +186,29 @@ struct plan_fftw<std::complex<double>, dir>{
     plan_fftw(int size, int howmanyffts, int stride, int dist) :
         plan(fftw_plan_many_dft(1, &size, howmanyffts, nullptr, nullptr, stride, dist,
                                                    nullptr, nullptr, stride, dist,
-                                                   (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE
+                                                   (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE | FFTW_UNALIGNED
                                ))
         {}
     //! \brief Identical to the float-complex specialization.
+    plan_fftw(int size, int howmanyffts, int stride, int dist, int blocks, int block_stride){
+        fftw_iodim fft_dim = {size, stride, stride};
+        std::array<fftw_iodim, 2> batch_dims = {{{howmanyffts, dist, dist}, {blocks, block_stride, block_stride}}};
+        plan = fftw_plan_guru_dft(1, &fft_dim, 2, batch_dims.data(), nullptr, nullptr,
+                                  (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE | FFTW_UNALIGNED);
+    }
+    //! \brief Identical to the float-complex specialization.
     plan_fftw(int size1, int size2, std::array<int, 2> const &embed, int howmanyffts, int stride, int dist){
         std::array<int, 2> size = {size2, size1};
 
         if (embed[0] == 0 and embed[1] == 0){
             plan = fftw_plan_many_dft(2, size.data(), howmanyffts, nullptr, nullptr, stride, dist,
                                                       nullptr, nullptr, stride, dist,
-                                                      (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE
+                                                      (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE | FFTW_UNALIGNED
                                      );
         }else{
             plan = fftw_plan_many_dft(2, size.data(), howmanyffts, nullptr, embed.data(), stride, dist,
                                                       nullptr, embed.data(), stride, dist,
-                                                      (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE
+                                                      (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE | FFTW_UNALIGNED
                                      );
         }
     }
@@ -185,7 +216,7 @@ struct plan_fftw<std::complex<double>, dir>{
     plan_fftw(int size1, int size2, int size3){
         std::array<int, 3> size = {size3, size2, size1};
         plan = fftw_plan_many_dft(3, size.data(), 1, nullptr, nullptr, 1, 1, nullptr, nullptr, 1, 1,
-                                  (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE);
+                                  (dir == direction::forward) ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_ESTIMATE | FFTW_UNALIGNED);
     }
     //! \brief Identical to the float-complex specialization.
     ~plan_fftw(){ fftw_destroy_plan(plan); }
@@ -264,34 +295,26 @@ public:
     //! \brief Forward fft, float-complex case.
     void forward(std::complex<float> data[], std::complex<float>*) const override{
         make_plan(cforward);
-        for(int i=0; i<blocks; i++){
-            fftwf_complex* block_data = reinterpret_cast<fftwf_complex*>(data + i * block_stride);
-            fftwf_execute_dft(*cforward, block_data, block_data);
-        }
+        fftwf_complex* cast_data = reinterpret_cast<fftwf_complex*>(data);
+        fftwf_execute_dft(*cforward, cast_data, cast_data);
     }
     //! \brief Backward fft, float-complex case.
     void backward(std::complex<float> data[], std::complex<float>*) const override{
         make_plan(cbackward);
-        for(int i=0; i<blocks; i++){
-            fftwf_complex* block_data = reinterpret_cast<fftwf_complex*>(data + i * block_stride);
-            fftwf_execute_dft(*cbackward, block_data, block_data);
-        }
+        fftwf_complex* cast_data = reinterpret_cast<fftwf_complex*>(data);
+        fftwf_execute_dft(*cbackward, cast_data, cast_data);
     }
     //! \brief Forward fft, double-complex case.
     void forward(std::complex<double> data[], std::complex<double>*) const override{
         make_plan(zforward);
-        for(int i=0; i<blocks; i++){
-            fftw_complex* block_data = reinterpret_cast<fftw_complex*>(data + i * block_stride);
-            fftw_execute_dft(*zforward, block_data, block_data);
-        }
+        fftw_complex* cast_data = reinterpret_cast<fftw_complex*>(data);
+        fftw_execute_dft(*zforward, cast_data, cast_data);
     }
     //! \brief Backward fft, double-complex case.
     void backward(std::complex<double> data[], std::complex<double>*) const override{
         make_plan(zbackward);
-        for(int i=0; i<blocks; i++){
-            fftw_complex* block_data = reinterpret_cast<fftw_complex*>(data + i * block_stride);
-            fftw_execute_dft(*zbackward, block_data, block_data);
-        }
+        fftw_complex* cast_data = reinterpret_cast<fftw_complex*>(data);
+        fftw_execute_dft(*zbackward, cast_data, cast_data);
     }
 
     //! \brief Converts the real data to complex and performs float-complex forward transform.
@@ -327,6 +350,8 @@ private:
         if (not plan){
             if (dist == 0)
                 plan = std::unique_ptr<plan_fftw<scalar_type, dir>>(new plan_fftw<scalar_type, dir>(size, size2, howmanyffts));
+            else if (size2 == 0 and blocks > 1) // middle dimension, all blocks of 1-D transforms in one plan
+                plan = std::unique_ptr<plan_fftw<scalar_type, dir>>(new plan_fftw<scalar_type, dir>(size, howmanyffts, stride, dist, blocks, block_stride));
             else if (size2 == 0)
                 plan = std::unique_ptr<plan_fftw<scalar_type, dir>>(new plan_fftw<scalar_type, dir>(size, howmanyffts, stride, dist));
             else
@@ -361,11 +386,11 @@ struct plan_fftw<float, dir>{
         plan((dir == direction::forward) ?
              fftwf_plan_many_dft_r2c(1, &size, howmanyffts, nullptr, nullptr, stride, rdist,
                                                    nullptr, nullptr, stride, cdist,
-                                                   FFTW_ESTIMATE
+                                                   FFTW_ESTIMATE | FFTW_UNALIGNED
                                    ) :
              fftwf_plan_many_dft_c2r(1, &size, howmanyffts, nullptr, nullptr, stride, cdist,
                                                    nullptr, nullptr, stride, rdist,
-                                                   FFTW_ESTIMATE
+                                                   FFTW_ESTIMATE | FFTW_UNALIGNED
                                    ))
         {}
     //! \brief Identical to the float-complex specialization.
@@ -386,11 +411,11 @@ struct plan_fftw<double, dir>{
         plan((dir == direction::forward) ?
              fftw_plan_many_dft_r2c(1, &size, howmanyffts, nullptr, nullptr, stride, rdist,
                                                    nullptr, nullptr, stride, cdist,
-                                                   FFTW_ESTIMATE
+                                                   FFTW_ESTIMATE | FFTW_UNALIGNED
                                    ) :
              fftw_plan_many_dft_c2r(1, &size, howmanyffts, nullptr, nullptr, stride, cdist,
                                                    nullptr, nullptr, stride, rdist,
-                                                   FFTW_ESTIMATE
+                                                   FFTW_ESTIMATE | FFTW_UNALIGNED
                                    ))
         {}
     //! \brief Identical to the float-complex specialization.
@@ -535,7 +560,7 @@ struct plan_fftw_r2r{
     plan_fftw_r2r(int size, int howmanyffts, int stride, int dist){
         auto kind = make_kind_array<1>();
         plan = fftw_r2r_types<scalar_type>::plan_many(1, &size, howmanyffts, nullptr, nullptr, stride, dist,
-                                                      nullptr, nullptr, stride, dist, kind.data(), FFTW_ESTIMATE);
+                                                      nullptr, nullptr, stride, dist, kind.data(), FFTW_ESTIMATE | FFTW_UNALIGNED);
     }
     //! \brief Identical to the float-complex specialization.
     plan_fftw_r2r(int size1, int size2, std::array<int, 2> const &embed, int howmanyffts, int stride, int dist){
@@ -544,17 +569,17 @@ struct plan_fftw_r2r{
 
         if (embed[0] == 0 and embed[1] == 0){
             plan = fftw_r2r_types<scalar_type>::plan_many(2, size.data(), howmanyffts, nullptr, nullptr, stride, dist,
-                                                          nullptr, nullptr, stride, dist, kind.data(), FFTW_ESTIMATE);
+                                                          nullptr, nullptr, stride, dist, kind.data(), FFTW_ESTIMATE | FFTW_UNALIGNED);
         }else{
             plan = fftw_r2r_types<scalar_type>::plan_many(2, size.data(), howmanyffts, nullptr, embed.data(), stride, dist,
-                                                          nullptr, embed.data(), stride, dist, kind.data(), FFTW_ESTIMATE);
+                                                          nullptr, embed.data(), stride, dist, kind.data(), FFTW_ESTIMATE | FFTW_UNALIGNED);
         }
     }
     //! \brief Identical to the float-complex specialization.
     plan_fftw_r2r(int size1, int size2, int size3){
         std::array<int, 3> size = {size3, size2, size1};
         auto kind = make_kind_array<3>();
-        plan = fftw_r2r_types<scalar_type>::plan_many(3, size.data(), 1, nullptr, nullptr, 1, 1, nullptr, nullptr, 1, 1, kind.data(), FFTW_ESTIMATE);
+        plan = fftw_r2r_types<scalar_type>::plan_many(3, size.data(), 1, nullptr, nullptr, 1, 1, nullptr, nullptr, 1, 1, kind.data(), FFTW_ESTIMATE | FFTW_UNALIGNED);
     }
     //! \brief Make the array with the kind of the transform.
     template<size_t dims> static std::array<fftw_r2r_kind, dims> make_kind_array() {
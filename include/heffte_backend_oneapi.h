@@ -683,6 +683,8 @@ template<> struct one_dim_backend<backend::onemkl_sin>{
  * \brief Simple packer that copies sub-boxes without transposing the order of the indexes.
  */
 template<> struct direct_packer<tag::gpu>{
+    //! \brief Constructor, the non-temporal mode is a no-op on the GPU.
+    direct_packer(bool = false){}
     //! \brief Execute the planned pack operation.
     template<typename scalar_type, typename index>
     void pack(sycl::queue &stream, pack_plan_3d<index> const &plan, scalar_type const data[], scalar_type buffer[]) const{
@@ -700,6 +702,8 @@ template<> struct direct_packer<tag::gpu>{
  * \brief GPU version of the transpose packer.
  */
 template<> struct transpose_packer<tag::gpu>{
+    //! \brief Constructor, the non-temporal mode is a no-op on the GPU.
+    transpose_packer(bool = false){}
     //! \brief Execute the planned pack operation.
     template<typename scalar_type, typename index>
     void pack(sycl::queue &stream, pack_plan_3d<index> const &plan, scalar_type const data[], scalar_type buffer[]) const{
@@ -932,6 +932,8 @@ template<> struct one_dim_backend<backend::rocfft_cos1>{
  * \brief Simple packer that copies sub-boxes without transposing the order of the indexes.
  */
 template<> struct direct_packer<tag::gpu>{
+    //! \brief Constructor, the non-temporal mode is a no-op on the GPU.
+    direct_packer(bool = false){}
     //! \brief Execute the planned pack operation.
     template<typename scalar_type, typename index>
     void pack(hipStream_t stream, pack_plan_3d<index> const &plan, scalar_type const data[], scalar_type buffer[]) const{
@@ -949,6 +951,8 @@ template<> struct direct_packer<tag::gpu>{
  * \brief GPU version of the transpose packer.
  */
 template<> struct transpose_packer<tag::gpu>{
+    //! \brief Constructor, the non-temporal mode is a no-op on the GPU.
+    transpose_packer(bool = false){}
     //! \brief Execute the planned pack operation.
     template<typename scalar_type, typename index>
     void pack(hipStream_t stream, pack_plan_3d<index> const &plan, scalar_type const data[], scalar_type buffer[]) const{
@@ -75,6 +75,163 @@ template<> struct is_zcomplex<stock::Complex<double, 8>> : std::true_type{};
 #endif // Heffte_ENABLE_AVX512
 #endif // Heffte_ENABLE_AVX
 
+namespace stock {
+/*!
+ * \ingroup hefftestock
+ * \brief Converts real numbers to complex, the imaginary parts are set to zero.
+ *
+ * Generic scalar loop, the AVX builds provide vectorized overloads for float and double.
+ */
+template<typename precision_type>
+inline void convert(int num_entries, precision_type const source[], std::complex<precision_type> destination[]){
+    for(int i=0; i<num_entries; i++) destination[i] = std::complex<precision_type>(source[i]);
+}
+/*!
+ * \ingroup hefftestock
+ * \brief Converts complex numbers to real, truncates the imaginary parts.
+ */
+template<typename precision_type>
+inline void convert(int num_entries, std::complex<precision_type> const source[], precision_type destination[]){
+    for(int i=0; i<num_entries; i++) destination[i] = std::real(source[i]);
+}
+
+#ifdef Heffte_ENABLE_AVX
+#ifdef Heffte_ENABLE_AVX512
+/*!
+ * \ingroup hefftestock
+ * \brief AVX512 variant of convert(), interleaves 16 reals with zeros per iteration.
+ */
+inline void convert(int num_entries, float const source[], std::complex<float> destination[]){
+    float *dest = reinterpret_cast<float*>(destination);
+    __m512i const idx_lo = _mm512_set_epi32(23, 7, 22, 6, 21, 5, 20, 4, 19, 3, 18, 2, 17, 1, 16, 0);
+    __m512i const idx_hi = _mm512_set_epi32(31, 15, 30, 14, 29, 13, 28, 12, 27, 11, 26, 10, 25, 9, 24, 8);
+    __m512 const zero = _mm512_setzero_ps();
+    int i = 0;
+    for(; i + 16 <= num_entries; i += 16){
+        __m512 r = _mm512_loadu_ps(source + i);
+        _mm512_storeu_ps(dest + 2*i,      _mm512_permutex2var_ps(r, idx_lo, zero));
+        _mm512_storeu_ps(dest + 2*i + 16, _mm512_permutex2var_ps(r, idx_hi, zero));
+    }
+    for(; i < num_entries; i++) destination[i] = std::complex<float>(source[i]);
+}
+/*!
+ * \ingroup hefftestock
+ * \brief AVX512 variant of convert(), interleaves 8 reals with zeros per iteration.
+ */
+inline void convert(int num_entries, double const source[], std::complex<double> destination[]){
+    double *dest = reinterpret_cast<double*>(destination);
+    __m512i const idx_lo = _mm512_set_epi64(11, 3, 10, 2, 9, 1, 8, 0);
+    __m512i const idx_hi = _mm512_set_epi64(15, 7, 14, 6, 13, 5, 12, 4);
+    __m512d const zero = _mm512_setzero_pd();
+    int i = 0;
+    for(; i + 8 <= num_entries; i += 8){
+        __m512d r = _mm512_loadu_pd(source + i);
+        _mm512_storeu_pd(dest + 2*i,     _mm512_permutex2var_pd(r, idx_lo, zero));
+        _mm512_storeu_pd(dest + 2*i + 8, _mm512_permutex2var_pd(r, idx_hi, zero));
+    }
+    for(; i < num_entries; i++) destination[i] = std::complex<double>(source[i]);
+}
+/*!
+ * \ingroup hefftestock
+ * \brief AVX512 variant of convert(), extracts the real parts of 16 complex numbers per iteration.
+ */
+inline void convert(int num_entries, std::complex<float> const source[], float destination[]){
+    float const *src = reinterpret_cast<float const*>(source);
+    __m512i const idx_re = _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+    int i = 0;
+    for(; i + 16 <= num_entries; i += 16){
+        __m512 a = _mm512_loadu_ps(src + 2*i);
+        __m512 b = _mm512_loadu_ps(src + 2*i + 16);
+        _mm512_storeu_ps(destination + i, _mm512_permutex2var_ps(a, idx_re, b));
+    }
+    for(; i < num_entries; i++) destination[i] = std::real(source[i]);
+}
+/*!
+ * \ingroup hefftestock
+ * \brief AVX512 variant of convert(), extracts the real parts of 8 complex numbers per iteration.
+ */
+inline void convert(int num_entries, std::complex<double> const source[], double destination[]){
+    double const *src = reinterpret_cast<double const*>(source);
+    __m512i const idx_re = _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0);
+    int i = 0;
+    for(; i + 8 <= num_entries; i += 8){
+        __m512d a = _mm512_loadu_pd(src + 2*i);
+        __m512d b = _mm512_loadu_pd(src + 2*i + 8);
+        _mm512_storeu_pd(destination + i, _mm512_permutex2var_pd(a, idx_re, b));
+    }
+    for(; i < num_entries; i++) destination[i] = std::real(source[i]);
+}
+#else
+/*!
+ * \ingroup hefftestock
+ * \brief AVX variant of convert(), interleaves 8 reals with zeros per iteration.
+ */
+inline void convert(int num_entries, float const source[], std::complex<float> destination[]){
+    float *dest = reinterpret_cast<float*>(destination);
+    __m256 const zero = _mm256_setzero_ps();
+    int i = 0;
+    for(; i + 8 <= num_entries; i += 8){
+        __m256 r = _mm256_loadu_ps(source + i);
+        __m256 lo = _mm256_unpacklo_ps(r, zero);
+        __m256 hi = _mm256_unpackhi_ps(r, zero);
+        _mm256_storeu_ps(dest + 2*i,     _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(dest + 2*i + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+    for(; i < num_entries; i++) destination[i] = std::complex<float>(source[i]);
+}
+/*!
+ * \ingroup hefftestock
+ * \brief AVX variant of convert(), interleaves 4 reals with zeros per iteration.
+ */
+inline void convert(int num_entries, double const source[], std::complex<double> destination[]){
+    double *dest = reinterpret_cast<double*>(destination);
+    __m256d const zero = _mm256_setzero_pd();
+    int i = 0;
+    for(; i + 4 <= num_entries; i += 4){
+        __m256d r = _mm256_loadu_pd(source + i);
+        __m256d lo = _mm256_unpacklo_pd(r, zero);
+        __m256d hi = _mm256_unpackhi_pd(r, zero);
+        _mm256_storeu_pd(dest + 2*i,     _mm256_permute2f128_pd(lo, hi, 0x20));
+        _mm256_storeu_pd(dest + 2*i + 4, _mm256_permute2f128_pd(lo, hi, 0x31));
+    }
+    for(; i < num_entries; i++) destination[i] = std::complex<double>(source[i]);
+}
+/*!
+ * \ingroup hefftestock
+ * \brief AVX variant of convert(), extracts the real parts of 8 complex numbers per iteration.
+ */
+inline void convert(int num_entries, std::complex<float> const source[], float destination[]){
+    float const *src = reinterpret_cast<float const*>(source);
+    int i = 0;
+    for(; i + 8 <= num_entries; i += 8){
+        __m256 a = _mm256_loadu_ps(src + 2*i);
+        __m256 b = _mm256_loadu_ps(src + 2*i + 8);
+        __m256 lo = _mm256_permute2f128_ps(a, b, 0x20);
+        __m256 hi = _mm256_permute2f128_ps(a, b, 0x31);
+        _mm256_storeu_ps(destination + i, _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+    for(; i < num_entries; i++) destination[i] = std::real(source[i]);
+}
+/*!
+ * \ingroup hefftestock
+ * \brief AVX variant of convert(), extracts the real parts of 4 complex numbers per iteration.
+ */
+inline void convert(int num_entries, std::complex<double> const source[], double destination[]){
+    double const *src = reinterpret_cast<double const*>(source);
+    int i = 0;
+    for(; i + 4 <= num_entries; i += 4){
+        __m256d a = _mm256_loadu_pd(src + 2*i);
+        __m256d b = _mm256_loadu_pd(src + 2*i + 4);
+        __m256d lo = _mm256_permute2f128_pd(a, b, 0x20);
+        __m256d hi = _mm256_permute2f128_pd(a, b, 0x31);
+        _mm256_storeu_pd(destination + i, _mm256_unpacklo_pd(lo, hi));
+    }
+    for(; i < num_entries; i++) destination[i] = std::real(source[i]);
+}
+#endif // Heffte_ENABLE_AVX512
+#endif // Heffte_ENABLE_AVX
+}
+
 #ifdef Heffte_ENABLE_AVX
 
 //! \brief Copy an array of numbers into a stock::Complex where only the first c_len spots are filled
@@ -128,7 +285,8 @@ struct plan_stock_fft{
      * \param cdist is the distance between the first entries of consecutive sequences in the complex sequences
      */
     plan_stock_fft(int size, int howmanyffts, int stride, int rdist, int cdist):
-                    N(size), num_ffts(howmanyffts), stride_sz(stride), real_d(rdist), comp_d(cdist) {
+                    N(size), num_ffts(howmanyffts), stride_sz(stride), real_d(rdist), comp_d(cdist),
+                    inp(size), out(size) {
         numNodes = stock::getNumNodes(N);
         root = std::unique_ptr<stock::biFuncNode<F,L>[]>(new stock::biFuncNode<F,L>[numNodes]);
         init_fft_tree(root.get(), N);
@@ -137,12 +295,10 @@ struct plan_stock_fft{
     int N, num_ffts, stride_sz, real_d, comp_d, numNodes;
     constexpr static int L = pack_size<F>::size;
     std::unique_ptr<stock::biFuncNode<F,L>[]> root;
-    //! \brief Execute C2R FFT
-    void execute(std::complex<F> const idata[], F odata[]) {
-        // Allocate input and output temporary arrays
-        stock::complex_vector<F,L> inp (N);
-        stock::complex_vector<F,L> out (N);
-
+    //! \brief Input and output scratch arrays, persistent across execute() calls.
+    stock::complex_vector<F,L> inp, out;
+    //! \brief Execute C2R FFT, fusing the multiplication by \b scale into the final store
+    void execute(std::complex<F> const idata[], F odata[], F scale = 1.0) {
         // Perform batch transform on everything save for the remainder
         for(int p = 0; p+((L/2)-1) < num_ffts; p += (L/2)) {
             // Convert types
@@ -157,7 +313,7 @@ struct plan_stock_fft{
             // Convert type back
             for(int i = 0; i < N; i++) {
                 int idx = p*real_d + i*stride_sz;
-                stock::Complex<F,L> arr = out[i];
+                stock::Complex<F,L> arr = out[i] * scale;
                 for(int j = 0; j < L/2; j++) odata[idx+j*real_d] = arr[j].real();
             }
         }
@@ -176,7 +332,7 @@ struct plan_stock_fft{
             root[0].fptr(inp.data(), out.data(), 1, 1, root.get(), dir);
             for(int i = 0; i < N; i++) {
                 int idx = p*real_d + i*stride_sz;
-                stock::Complex<F,L> arr = out[i];
+                stock::Complex<F,L> arr = out[i] * scale;
                 // Only need first k columns
                 for(int k = 0; k < rem; k++) {
                     odata[idx + k*real_d] = arr[k].real();
@@ -184,12 +340,8 @@ struct plan_stock_fft{
             }
         }
     }
-    //! \brief Execute R2C FFT
-    void execute(F const idata[], std::complex<F> odata[]) {
-        // Allocate input and output temporary arrays
-        stock::complex_vector<F,L> inp (N);
-        stock::complex_vector<F,L> out (N);
-
+    //! \brief Execute R2C FFT, fusing the multiplication by \b scale into the final store
+    void execute(F const idata[], std::complex<F> odata[], F scale = 1.0) {
         // Perform batch transform on everything save for the remainder
         for(int p = 0; p+((L/2)-1) < num_ffts; p += L/2) {
             // Convert types
@@ -202,7 +354,7 @@ struct plan_stock_fft{
             // Convert type back
             for(int i = 0; i < (N+2)/2; i++) {
                 int idx = p*comp_d + i*stride_sz;
-                stock::Complex<F,L> arr = out[i];
+                stock::Complex<F,L> arr = out[i] * scale;
                 for(int j = 0; j < L/2; j++) odata[idx+j*comp_d] = arr[j];
             }
         }
@@ -220,7 +372,7 @@ struct plan_stock_fft{
             root[0].fptr(inp.data(), out.data(), 1, 1, root.get(), dir);
             for(int i = 0; i < (N+2)/2; i++) {
                 int idx = p*comp_d + i*stride_sz;
-                stock::Complex<F,L> arr = out[i];
+                stock::Complex<F,L> arr = out[i] * scale;
                 // Only need first k columns
                 for(int k = 0; k < rem; k++) {
                     odata[idx + k*comp_d] = arr[k];
@@ -247,7 +399,8 @@ struct plan_stock_fft<std::complex<F>, dir>{
      * \param dist is the distance between the first entries of consecutive sequences
      */
     plan_stock_fft(int size, int howmanyffts, int stride, int dist):
-                   N(size), num_ffts(howmanyffts), stride_sz(stride), idist(dist), odist(dist) {
+                   N(size), num_ffts(howmanyffts), stride_sz(stride), idist(dist), odist(dist),
+                   inp(size), out(size) {
         numNodes = stock::getNumNodes(N);
         root = std::unique_ptr<stock::biFuncNode<F,L>[]>(new stock::biFuncNode<F,L>[numNodes]);
         init_fft_tree(root.get(), N);
@@ -256,12 +409,10 @@ struct plan_stock_fft<std::complex<F>, dir>{
     int N, num_ffts, stride_sz, idist, odist, numNodes;
     constexpr static int L = pack_size<F>::size;
     std::unique_ptr<stock::biFuncNode<F, L>[]> root;
-    //! \brief Execute an FFT inplace on std::complex<F> data
-    void execute(std::complex<F> data[]) {
-        // Allocate input and output temporary arrays
-        stock::complex_vector<F,L> inp (N);
-        stock::complex_vector<F,L> out (N);
-
+    //! \brief Input and output scratch arrays, persistent across execute() calls.
+    stock::complex_vector<F,L> inp, out;
+    //! \brief Execute an FFT inplace on std::complex<F> data, fusing the multiplication by \b scale into the final store
+    void execute(std::complex<F> data[], F scale = 1.0) {
         // Perform batch transform on everything save for the remainder
         for(int p = 0; p + (L/2 - 1) < num_ffts; p += L/2) {
             // Convert types
@@ -274,7 +425,7 @@ struct plan_stock_fft<std::complex<F>, dir>{
             // Convert type back
             for(int i = 0; i < N; i++) {
                 int idx = p*odist + i*stride_sz;
-                stock::Complex<F,L> arr = out[i];
+                stock::Complex<F,L> arr = out[i] * scale;
                 for(int j = 0; j < L/2; j++) data[idx+j*odist] = arr[j];
             }
         }
@@ -292,7 +443,7 @@ struct plan_stock_fft<std::complex<F>, dir>{
             root[0].fptr(inp.data(), out.data(), 1, 1, root.get(), dir);
             for(int i = 0; i < N; i++) {
                 int idx = p*odist + i*stride_sz;
-                stock::Complex<F,L> arr = out[i];
+                stock::Complex<F,L> arr = out[i] * scale;
                 // Only need first k columns
                 for(int k = 0; k < rem; k++) {
                     data[idx + k*odist] = arr[k];
@@ -322,7 +473,8 @@ struct plan_stock_fft{
      * \param cdist is the distance between the first entries of consecutive sequences in the complex sequences
      */
     plan_stock_fft(int size, int howmanyffts, int stride, int rdist, int cdist):
-                    N(size), num_ffts(howmanyffts), stride_sz(stride), real_d(rdist), comp_d(cdist) {
+                    N(size), num_ffts(howmanyffts), stride_sz(stride), real_d(rdist), comp_d(cdist),
+                    inp(size), out(size) {
         numNodes = stock::getNumNodes(N);
         root = std::unique_ptr<stock::biFuncNode<F,1>[]>(new stock::biFuncNode<F,1>[numNodes]);
         init_fft_tree(root.get(), N);
@@ -330,12 +482,10 @@ struct plan_stock_fft{
     //! \brief Identical to the F-complex specialization.
     int N, num_ffts, stride_sz, real_d, comp_d, numNodes;
     std::unique_ptr<stock::biFuncNode<F, 1>[]> root;
-    //! \brief Execute C2R FFT
-    void execute(std::complex<F> const idata[], F odata[]) {
-        // Allocate input and output temporary arrays
-        stock::complex_vector<F,1> inp (N);
-        stock::complex_vector<F,1> out (N);
-
+    //! \brief Input and output scratch arrays, persistent across execute() calls.
+    stock::complex_vector<F,1> inp, out;
+    //! \brief Execute C2R FFT, fusing the multiplication by \b scale into the final store
+    void execute(std::complex<F> const idata[], F odata[], F scale = 1.0) {
         // Perform batch transform on everything save for the remainder
         for(int p = 0; p < num_ffts; p++) {
             // Convert types
@@ -350,17 +500,13 @@ struct plan_stock_fft{
             // Convert type back
             for(int i = 0; i < N; i++) {
                 int idx = p*real_d + i*stride_sz;
-                stock::Complex<F,1> arr = out[i];
+                stock::Complex<F,1> arr = out[i] * scale;
                 odata[idx+0*real_d] = arr[0].real();
             }
         }
     }
-    //! \brief Execute R2C FFT
-    void execute(F const idata[], std::complex<F> odata[]) {
-        // Allocate input and output temporary arrays
-        stock::complex_vector<F,1> inp (N);
-        stock::complex_vector<F,1> out (N);
-
+    //! \brief Execute R2C FFT, fusing the multiplication by \b scale into the final store
+    void execute(F const idata[], std::complex<F> odata[], F scale = 1.0) {
         // Perform batch transform on everything save for the remainder
         for(int p = 0; p < num_ffts; p++) {
             // Convert types
@@ -373,7 +519,7 @@ struct plan_stock_fft{
             // Convert type back
             for(int i = 0; i < (N+2)/2; i++) {
                 int idx = p*comp_d + i*stride_sz;
-                stock::Complex<F,1> arr = out[i];
+                stock::Complex<F,1> arr = out[i] * scale;
                 odata[idx+0*comp_d] = arr[0];
             }
         }
@@ -397,7 +543,8 @@ struct plan_stock_fft<std::complex<F>, dir>{
      * \param dist is the distance between the first entries of consecutive sequences
      */
     plan_stock_fft(int size, int howmanyffts, int stride, int dist):
-                    N(size), num_ffts(howmanyffts), stride_sz(stride), idist(dist), odist(dist) {
+                    N(size), num_ffts(howmanyffts), stride_sz(stride), idist(dist), odist(dist),
+                    inp(size), out(size) {
         numNodes = stock::getNumNodes(N);
         root = std::unique_ptr<stock::biFuncNode<F,1>[]>(new stock::biFuncNode<F,1>[numNodes]);
         init_fft_tree(root.get(), N);
@@ -405,12 +552,10 @@ struct plan_stock_fft<std::complex<F>, dir>{
 
     int N, num_ffts, stride_sz, idist, odist, numNodes;
     std::unique_ptr<stock::biFuncNode<F,1>[]> root;
-    //! \brief Execute an FFT inplace on std::complex<F> data
-    void execute(std::complex<F> data[]) {
-        // Allocate input and output temporary arrays
-        stock::complex_vector<F,1> inp (N);
-        stock::complex_vector<F,1> out (N);
-
+    //! \brief Input and output scratch arrays, persistent across execute() calls.
+    stock::complex_vector<F,1> inp, out;
+    //! \brief Execute an FFT inplace on std::complex<F> data, fusing the multiplication by \b scale into the final store
+    void execute(std::complex<F> data[], F scale = 1.0) {
         // Perform batch transform on everything save for the remainder
         for(int p = 0; p < num_ffts; p++) {
             // Convert types
@@ -423,7 +568,7 @@ struct plan_stock_fft<std::complex<F>, dir>{
             // Convert type back
             for(int i = 0; i < N; i++) {
                 int idx = p*odist + i*stride_sz;
-                stock::Complex<F, 1> arr = out[i];
+                stock::Complex<F, 1> arr = out[i] * scale;
                 data[idx+0*odist] = arr[0];
             }
         }
@@ -502,23 +647,73 @@ public:
 
     //! \brief Converts the real data to complex and performs float-complex forward transform.
     void forward(float const indata[], std::complex<float> outdata[], std::complex<float> *workspace) const override{
-        for(int i=0; i<total_size; i++) outdata[i] = std::complex<float>(indata[i]);
+        stock::convert(total_size, indata, outdata);
         forward(outdata, workspace);
     }
     //! \brief Performs backward float-complex transform and truncates the complex part of the result.
     void backward(std::complex<float> indata[], float outdata[], std::complex<float> *workspace) const override{
         backward(indata, workspace);
-        for(int i=0; i<total_size; i++) outdata[i] = std::real(indata[i]);
+        stock::convert(total_size, indata, outdata);
     }
     //! \brief Converts the real data to complex and performs double-complex forward transform.
     void forward(double const indata[], std::complex<double> outdata[], std::complex<double> *workspace) const override{
-        for(int i=0; i<total_size; i++) outdata[i] = std::complex<double>(indata[i]);
+        stock::convert(total_size, indata, outdata);
         forward(outdata, workspace);
     }
     //! \brief Performs backward double-complex transform and truncates the complex part of the result.
     void backward(std::complex<double> indata[], double outdata[], std::complex<double> *workspace) const override{
         backward(indata, workspace);
-        for(int i=0; i<total_size; i++) outdata[i] = std::real(indata[i]);
+        stock::convert(total_size, indata, outdata);
+    }
+
+    //! \brief Forward fft with scaling fused into the final store, float-complex case.
+    void forward(std::complex<float> data[], std::complex<float>*, double scale) const override{
+        make_plan(cforward);
+        for(int i=0; i<blocks; i++) {
+            cforward->execute(data + i * block_stride, static_cast<float>(scale));
+        }
+    }
+    //! \brief Backward fft with scaling fused into the final store, float-complex case.
+    void backward(std::complex<float> data[], std::complex<float>*, double scale) const override{
+        make_plan(cbackward);
+        for(int i=0; i<blocks; i++) {
+            cbackward->execute(data + i * block_stride, static_cast<float>(scale));
+        }
+    }
+    //! \brief Forward fft with scaling fused into the final store, double-complex case.
+    void forward(std::complex<double> data[], std::complex<double>*, double scale) const override{
+        make_plan(zforward);
+        for(int i=0; i<blocks; i++) {
+            zforward->execute(data + i * block_stride, scale);
+        }
+    }
+    //! \brief Backward fft with scaling fused into the final store, double-complex case.
+    void backward(std::complex<double> data[], std::complex<double>*, double scale) const override{
+        make_plan(zbackward);
+        for(int i=0; i<blocks; i++) {
+            zbackward->execute(data + i * block_stride, scale);
+        }
+    }
+
+    //! \brief Real-to-complex conversion with the scaling fused into the complex transform.
+    void forward(float const indata[], std::complex<float> outdata[], std::complex<float> *workspace, double scale) const override{
+        stock::convert(total_size, indata, outdata);
+        forward(outdata, workspace, scale);
+    }
+    //! \brief Complex-to-real truncation with the scaling fused into the complex transform.
+    void backward(std::complex<float> indata[], float outdata[], std::complex<float> *workspace, double scale) const override{
+        backward(indata, workspace, scale);
+        stock::convert(total_size, indata, outdata);
+    }
+    //! \brief Real-to-complex conversion with the scaling fused into the complex transform.
+    void forward(double const indata[], std::complex<double> outdata[], std::complex<double> *workspace, double scale) const override{
+        stock::convert(total_size, indata, outdata);
+        forward(outdata, workspace, scale);
+    }
+    //! \brief Complex-to-real truncation with the scaling fused into the complex transform.
+    void backward(std::complex<double> indata[], double outdata[], std::complex<double> *workspace, double scale) const override{
+        backward(indata, workspace, scale);
+        stock::convert(total_size, indata, outdata);
     }
 
     //! \brief Returns the size of the box.
@@ -603,6 +798,35 @@ public:
         }
     }
 
+    //! \brief Forward transform with scaling fused into the final store, single precision.
+    void forward(float const indata[], std::complex<float> outdata[], std::complex<float>*, double scale) const override{
+        make_plan(sforward);
+        for(int i=0; i<blocks; i++) {
+            sforward->execute(indata + i*rblock_stride, outdata + i*cblock_stride, static_cast<float>(scale));
+        }
+    }
+    //! \brief Backward transform with scaling fused into the final store, single precision.
+    void backward(std::complex<float> indata[], float outdata[], std::complex<float>*, double scale) const override{
+        make_plan(sbackward);
+        for(int i=0; i<blocks; i++) {
+            sbackward->execute(indata + i*cblock_stride, outdata + i*rblock_stride, static_cast<float>(scale));
+        }
+    }
+    //! \brief Forward transform with scaling fused into the final store, double precision.
+    void forward(double const indata[], std::complex<double> outdata[], std::complex<double>*, double scale) const override{
+        make_plan(dforward);
+        for(int i=0; i<blocks; i++) {
+            dforward->execute(indata + i*rblock_stride, outdata + i*cblock_stride, scale);
+        }
+    }
+    //! \brief Backward transform with scaling fused into the final store, double precision.
+    void backward(std::complex<double> indata[], double outdata[], std::complex<double>*, double scale) const override{
+        make_plan(dbackward);
+        for(int i=0; i<blocks; i++) {
+            dbackward->execute(indata + i*cblock_stride, outdata + i*rblock_stride, scale);
+        }
+    }
+
     //! \brief Returns the size of the box with real data.
     int box_size() const override{ return rsize; }
     //! \brief Returns the size of the box with complex coefficients.
@@ -16,6 +16,7 @@
 #include "heffte_backend_mkl.h"
 
 #include "heffte_backend_cuda.h"
+#include "heffte_backend_cufftmp.h"
 #include "heffte_backend_rocm.h"
 #include "heffte_backend_oneapi.h"
 
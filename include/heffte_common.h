@@ -177,6 +177,12 @@ namespace backend {
      */
     struct cufft_cos1{};
 
+    /*!
+     * \ingroup hefftecuda
+     * \brief Type-tag for the cuFFTMp backend, the MPI communication is handled by the cuFFTMp library
+     */
+    struct cufftmp{};
+
     /*!
      * \ingroup heffterocm
      * \brief Type-tag for the rocFFT backend
@@ -257,6 +263,18 @@ namespace backend {
                     typename std::enable_if<std::is_same<typename buffer_traits<backend_tag>::location, tag::gpu>::value, void>::type>
     : std::true_type{};
 
+    /*!
+     * \ingroup fft3dbackend
+     * \brief Struct that specializes to true type if the backend library handles the MPI communication internally.
+     *
+     * Defaults to std::false_type, i.e., the reshape operations are performed by the heFFTe
+     * heffte::reshape3d_base algorithms. Backends such as cuFFTMp perform the pencil/slab
+     * transposes inside the library plan, in which case heFFTe skips the reshape stages
+     * and invokes a single executor that spans the entire transform.
+     */
+    template<typename backend_tag>
+    struct uses_internal_reshape : std::false_type{};
+
     /*!
      * \ingroup fft3dbackend
      * \brief Returns the human readable name of the backend.
@@ -346,6 +364,11 @@ namespace backend {
      * \brief Returns the human readable name of the cuFFT backend.
      */
     template<> inline std::string name<cufft_cos1>(){ return "cufft-cos-type-I"; }
+    /*!
+     * \ingroup hefftecuda
+     * \brief Returns the human readable name of the cuFFTMp backend.
+     */
+    template<> inline std::string name<cufftmp>(){ return "cufftmp"; }
 
     /*!
      * \ingroup heffterocm
@@ -586,12 +609,96 @@ public:
     virtual void backward(std::complex<float>[], float[], std::complex<float>*) const{}
     //! \brief Backward FFT real-to-complex, double precision.
     virtual void backward(std::complex<double>[], double[], std::complex<double>*) const{}
+    //! \brief Forward r2r with fused scaling, single precision.
+    virtual void forward(float data[], float *workspace, double scale) const{
+        forward(data, workspace);
+        apply_scale_factor(box_size(), data, scale);
+    }
+    //! \brief Forward r2r with fused scaling, double precision.
+    virtual void forward(double data[], double *workspace, double scale) const{
+        forward(data, workspace);
+        apply_scale_factor(box_size(), data, scale);
+    }
+    //! \brief Backward r2r with fused scaling, single precision.
+    virtual void backward(float data[], float *workspace, double scale) const{
+        backward(data, workspace);
+        apply_scale_factor(box_size(), data, scale);
+    }
+    //! \brief Backward r2r with fused scaling, double precision.
+    virtual void backward(double data[], double *workspace, double scale) const{
+        backward(data, workspace);
+        apply_scale_factor(box_size(), data, scale);
+    }
+    /*!
+     * \brief Forward FFT with fused scaling, single precision.
+     *
+     * The scaled variants allow the scaling factor to be applied as part of the last
+     * transform stage, which avoids a separate pass over the entire output array.
+     * The default implementations scale the box immediately after the transform while
+     * the data is still cache-hot; backends can override and multiply at the final store.
+     * The data and the loop run on the CPU, backends holding the data on the GPU device
+     * apply the scaling with their native kernels instead of the fused variants.
+     */
+    virtual void forward(std::complex<float> data[], std::complex<float> *workspace, double scale) const{
+        forward(data, workspace);
+        apply_scale_factor(box_size(), data, scale);
+    }
+    //! \brief Forward FFT with fused scaling, double precision.
+    virtual void forward(std::complex<double> data[], std::complex<double> *workspace, double scale) const{
+        forward(data, workspace);
+        apply_scale_factor(box_size(), data, scale);
+    }
+    //! \brief Backward FFT with fused scaling, single precision.
+    virtual void backward(std::complex<float> data[], std::complex<float> *workspace, double scale) const{
+        backward(data, workspace);
+        apply_scale_factor(box_size(), data, scale);
+    }
+    //! \brief Backward FFT with fused scaling, double precision.
+    virtual void backward(std::complex<double> data[], std::complex<double> *workspace, double scale) const{
+        backward(data, workspace);
+        apply_scale_factor(box_size(), data, scale);
+    }
+    //! \brief Forward FFT real-to-complex with fused scaling, single precision.
+    virtual void forward(float const indata[], std::complex<float> outdata[], std::complex<float> *workspace, double scale) const{
+        forward(indata, outdata, workspace);
+        apply_scale_factor(complex_size(), outdata, scale);
+    }
+    //! \brief Forward FFT real-to-complex with fused scaling, double precision.
+    virtual void forward(double const indata[], std::complex<double> outdata[], std::complex<double> *workspace, double scale) const{
+        forward(indata, outdata, workspace);
+        apply_scale_factor(complex_size(), outdata, scale);
+    }
+    //! \brief Backward FFT complex-to-real with fused scaling, single precision.
+    virtual void backward(std::complex<float> indata[], float outdata[], std::complex<float> *workspace, double scale) const{
+        backward(indata, outdata, workspace);
+        apply_scale_factor(box_size(), outdata, scale);
+    }
+    //! \brief Backward FFT complex-to-real with fused scaling, double precision.
+    virtual void backward(std::complex<double> indata[], double outdata[], std::complex<double> *workspace, double scale) const{
+        backward(indata, outdata, workspace);
+        apply_scale_factor(box_size(), outdata, scale);
+    }
     //! \brief Return the size of the box.
     virtual int box_size() const{ return 0; }
     //! \brief Return the workspace of the size.
     virtual size_t workspace_size() const{ return 0; }
     //! \brief Return the size of the complex-box (r2c executors).
     virtual int complex_size() const{ return box_size(); }
+
+protected:
+    //! \brief Multiplies the first \b num_entries of \b data by the \b scale factor, no-op when the factor is one.
+    template<typename precision>
+    static void apply_scale_factor(int num_entries, precision data[], double scale){
+        if (scale != 1.0){
+            precision const s = static_cast<precision>(scale);
+            for(int i=0; i<num_entries; i++) data[i] *= s;
+        }
+    }
+    //! \brief Complex overload, the scaling factor is always real.
+    template<typename precision>
+    static void apply_scale_factor(int num_entries, std::complex<precision> data[], double scale){
+        apply_scale_factor(2 * num_entries, reinterpret_cast<precision*>(data), scale);
+    }
 };
 
 /*!
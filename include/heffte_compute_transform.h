@@ -43,6 +43,9 @@ namespace heffte {
      * \param shaper are the four stages of the reshape operations
      * \param executor holds the three stages of the one dimensional FFT algorithm
      * \param dir indicates whether to use the forward or backward method of the executor
+     * \param scale_factor is fused into the last active executor stage, pass 1.0 when
+     *                     the scaling is not needed or applied separately (e.g., GPU backends);
+     *                     requires at least one active executor
      * \endinternal
      */
     template<typename location_tag, typename index, typename scalar_type>
@@ -52,7 +55,7 @@ namespace heffte {
                         size_t executor_buffer_offset, size_t size_comm_buffers,
                         std::array<std::unique_ptr<reshape3d_base<index>>, 4> const &shaper,
                         std::array<executor_base*, 3> const &executor,
-                        direction dir);
+                        direction dir, double scale_factor = 1.0);
     /*!
      * \internal
      * \ingroup fft3d
@@ -76,7 +79,8 @@ namespace heffte {
                         std::complex<scalar_type> workspace[],
                         size_t executor_buffer_offset, size_t size_comm_buffers,
                         std::array<std::unique_ptr<reshape3d_base<index>>, 4> const &shaper,
-                        std::array<executor_base*, 3> const &executor, direction);
+                        std::array<executor_base*, 3> const &executor, direction,
+                        double scale_factor = 1.0);
     /*!
      * \internal
      * \ingroup fft3d
@@ -100,7 +104,8 @@ namespace heffte {
                         std::complex<scalar_type> workspace[],
                         size_t executor_buffer_offset, size_t size_comm_buffers,
                         std::array<std::unique_ptr<reshape3d_base<index>>, 4> const &shaper,
-                        std::array<executor_base*, 3> const &executor, direction);
+                        std::array<executor_base*, 3> const &executor, direction,
+                        double scale_factor = 1.0);
 
 }
 
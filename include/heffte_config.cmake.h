@@ -19,6 +19,7 @@
 #cmakedefine Heffte_ENABLE_FFTW
 #cmakedefine Heffte_ENABLE_MKL
 #cmakedefine Heffte_ENABLE_CUDA
+#cmakedefine Heffte_ENABLE_CUFFTMP
 #cmakedefine Heffte_ENABLE_ROCM
 #cmakedefine Heffte_ENABLE_ONEAPI
 
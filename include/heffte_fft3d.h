@@ -355,18 +355,19 @@ public:
         static_assert(backend::check_types<backend_tag, input_type, output_type>::value,
                       "Using either an unknown complex type or an incompatible pair of types!");
 
-        auto workspace = make_buffer_container<typename transform_output<typename define_standard_type<output_type>::type, backend_tag>::type>(this->stream(), size_workspace());
-        forward(convert_to_standard(input), convert_to_standard(output), workspace.data(), scaling);
+        using standard_workspace = typename transform_output<typename define_standard_type<output_type>::type, backend_tag>::type;
+        forward(convert_to_standard(input), convert_to_standard(output),
+                cached_workspace(size_workspace(), standard_workspace()), scaling);
     }
 
     /*!
      * \brief An overload utilizing a user-allocated workspace buffer.
      *
      * HeFFTe requires additional buffers to for various MPI operations, e.g., pack-send-receive-unpack.
-     * In the standard overload, the extra memory will be allocated during the call to forward()
-     * and released right after.
-     * However, allocating and deallocation of large buffers can have a measurable negative effect on performance.
-     * Optionally, the use can allocate the workspace buffer externally and pass it into the HeFFTe calls.
+     * In the standard overload, the extra memory will be allocated on the first call to forward()
+     * or backward() and will be kept allocated for the lifetime of the class.
+     * Optionally, the use can allocate the workspace buffer externally and pass it into the HeFFTe calls,
+     * e.g., to control when the memory is released or to share a buffer between transform objects.
      *
      * The workspace buffer must have size equal to size_workspace() and measured in number of complex scalars,
      * e.g., std::complex<float> or std::complex<double> for single and double precision respectively.
@@ -379,8 +380,9 @@ public:
         compute_transform<location_tag, index>(this->stream(), 1, convert_to_standard(input), convert_to_standard(output),
                                                convert_to_standard(workspace),
                                                executor_buffer_offset, size_comm_buffers(), forward_shaper,
-                                               forward_executors(), direction::forward);
-        apply_scale(1, direction::forward, scaling, convert_to_standard(output));
+                                               forward_executors(), direction::forward, fused_scale_factor(scaling));
+        if (not fuses_scaling())
+            apply_scale(1, direction::forward, scaling, convert_to_standard(output));
     }
     /*!
      * \brief An overload allowing for a batch of FFTs to be performed in a single command.
@@ -397,8 +399,9 @@ public:
         compute_transform<location_tag, index>(this->stream(), batch_size, convert_to_standard(input), convert_to_standard(output),
                                                convert_to_standard(workspace),
                                                executor_buffer_offset, size_comm_buffers(), forward_shaper,
-                                               forward_executors(), direction::forward);
-        apply_scale(batch_size, direction::forward, scaling, convert_to_standard(output));
+                                               forward_executors(), direction::forward, fused_scale_factor(scaling));
+        if (not fuses_scaling())
+            apply_scale(batch_size, direction::forward, scaling, convert_to_standard(output));
     }
     /*!
      * \brief An overload that allocates workspace internally.
@@ -408,9 +411,9 @@ public:
         static_assert(backend::check_types<backend_tag, input_type, output_type>::value,
                       "Using either an unknown complex type or an incompatible pair of types!");
 
-        auto workspace = make_buffer_container<typename transform_output<typename define_standard_type<output_type>::type, backend_tag>::type>(this->stream(), batch_size * size_workspace());
-
-        forward(batch_size, input, output, workspace.data(), scaling);
+        using standard_workspace = typename transform_output<typename define_standard_type<output_type>::type, backend_tag>::type;
+        forward(batch_size, input, output,
+                reinterpret_cast<output_type*>(cached_workspace(batch_size * size_workspace(), standard_workspace())), scaling);
     }
 
     /*!
@@ -470,8 +473,8 @@ public:
         static_assert(backend::check_types<backend_tag, output_type, input_type>::value,
                       "Using either an unknown complex type or an incompatible pair of types!");
 
-        auto workspace = make_buffer_container<typename transform_output<input_type, backend_tag>::type>(this->stream(), size_workspace());
-        backward(input, output, workspace.data(), scaling);
+        backward(input, output, reinterpret_cast<input_type*>(
+                     cached_workspace(size_workspace(), typename define_standard_type<input_type>::type())), scaling);
     }
 
     /*!
@@ -485,8 +488,9 @@ public:
         compute_transform<location_tag, index>(this->stream(), 1, convert_to_standard(input), convert_to_standard(output),
                                                convert_to_standard(workspace),
                                                executor_buffer_offset, size_comm_buffers(), backward_shaper,
-                                               backward_executors(), direction::backward);
-        apply_scale(1, direction::backward, scaling, convert_to_standard(output));
+                                               backward_executors(), direction::backward, fused_scale_factor(scaling));
+        if (not fuses_scaling())
+            apply_scale(1, direction::backward, scaling, convert_to_standard(output));
     }
     /*!
      * \brief Overload for batch transforms, see the corresponding overload of forward().
@@ -500,8 +504,9 @@ public:
         compute_transform<location_tag, index>(this->stream(), batch_size, convert_to_standard(input), convert_to_standard(output),
                                                convert_to_standard(workspace),
                                                executor_buffer_offset, size_comm_buffers(), backward_shaper,
-                                               backward_executors(), direction::backward);
-        apply_scale(batch_size, direction::backward, scaling, convert_to_standard(output));
+                                               backward_executors(), direction::backward, fused_scale_factor(scaling));
+        if (not fuses_scaling())
+            apply_scale(batch_size, direction::backward, scaling, convert_to_standard(output));
     }
     /*!
      * \brief Overload for batch transforms with internally allocated workspace.
@@ -511,8 +516,8 @@ public:
         static_assert(backend::check_types<backend_tag, output_type, input_type>::value,
                       "Using either an unknown complex type or an incompatible pair of types!");
 
-        auto workspace = make_buffer_container<typename transform_output<input_type, backend_tag>::type>(this->stream(), batch_size * size_workspace());
-        backward(batch_size, input, output, workspace.data(), scaling);
+        backward(batch_size, input, output, reinterpret_cast<input_type*>(
+                     cached_workspace(batch_size * size_workspace(), typename define_standard_type<input_type>::type())), scaling);
     }
 
     /*!
@@ -529,6 +534,32 @@ public:
         return result;
     }
 
+    /*!
+     * \brief Overload that consumes the input and reuses its memory for the result.
+     *
+     * Identical to the const reference overload, but the transform is performed in-place
+     * in the \b input buffer, which skips the allocation of a second buffer of
+     * size_inbox() entries and the corresponding write of the result.
+     * The buffer is grown if size_inbox() exceeds the current size, otherwise the
+     * returned container keeps the size of the input and only the leading
+     * size_inbox() entries hold the result.
+     */
+    template<typename scalar_type>
+    buffer_container<scalar_type> backward(buffer_container<scalar_type> &&input, scale scaling = scale::none){
+        static_assert(not backend::uses_fft_types<backend_tag>::value or is_ccomplex<scalar_type>::value or is_zcomplex<scalar_type>::value,
+                      "Either calling backward() with non-complex input or using an unknown complex type.");
+        if (input.size() < static_cast<size_t>(size_outbox()))
+            throw std::invalid_argument("The input vector is smaller than size_outbox(), i.e., not enough entries provided to fill the outbox.");
+        if (input.size() < static_cast<size_t>(size_inbox())){
+            // in-place operation requires room for both the input and the result
+            auto grown = make_buffer_container<scalar_type>(this->stream(), size_inbox());
+            backend::data_manipulator<location_tag>::copy_n(this->stream(), input.data(), size_outbox(), grown.data());
+            input = std::move(grown);
+        }
+        backward(input.data(), input.data(), scaling);
+        return std::move(input);
+    }
+
     /*!
      * \brief Perform complex-to-real backward FFT using vector API (truncates the complex part).
      */
@@ -541,9 +572,9 @@ public:
         return result;
     }
 
-    //! \brief Returns the scale factor for the given scaling.
+    //! \brief Returns the scale factor for the given scaling, the values are hoisted into the plan setup.
     double get_scale_factor(scale scaling) const{
-        return (scaling == scale::symmetric) ? std::sqrt(scale_factor) : scale_factor;
+        return (scaling == scale::symmetric) ? symmetric_scale_factor : scale_factor;
     }
 
     //! \brief Returns the workspace size that will be used, size is measured in complex numbers.
@@ -622,6 +653,26 @@ private:
             executors[2] = make_executor<backend_tag>(this->stream(), plan.out_shape[2][my_rank], plan.fft_direction[2]);
         }
 
+        // if no executor stage follows the last reshape, then the reshape writes the user
+        // output which will not be read again and the cpu packers can use streaming stores
+        auto mark_final_stage = [&](std::array<std::unique_ptr<reshape3d_base<index>>, 4> const &shaper,
+                                    std::array<executor_base*, 3> const &execs)
+            ->void{
+                int last = get_last_active(shaper);
+                if (last >= 0){
+                    bool executor_after = false;
+                    for(int i=last; i<3; i++) executor_after = executor_after or (execs[i] != nullptr);
+                    if (not executor_after) shaper[last]->set_final_stage();
+                }
+            };
+        mark_final_stage(forward_shaper, forward_executors());
+        mark_final_stage(backward_shaper, backward_executors());
+
+        // compute_transform() completes deferred sends before the workspace is reused,
+        // so the reshapes can overlap the completion of the sends with the fft stages
+        for(auto &s : forward_shaper) if (s) s->set_deferred_sends();
+        for(auto &s : backward_shaper) if (s) s->set_deferred_sends();
+
         size_t executor_workspace_size = get_max_work_size(executors);
         comm_buffer_offset = std::max(get_workspace_size(forward_shaper), get_workspace_size(backward_shaper));
         // the last junk of (fft0->box_size() + 1) / 2 is used only when doing complex-to-real backward transform
@@ -648,6 +699,9 @@ private:
                 scale_factor /= 64.0;
             }
         }
+
+        // hoisted from get_scale_factor() so the symmetric scaling does not take a sqrt on every call
+        symmetric_scale_factor = std::sqrt(scale_factor);
     }
     //! \brief Return references to the executors in forward order.
     std::array<executor_base*, 3> forward_executors() const{
@@ -658,6 +712,40 @@ private:
         return std::array<executor_base*, 3>{executors[2].get(), executors[1].get(), executors[0].get()};
     }
 
+    /*!
+     * \brief Returns a persistent workspace buffer with at least \b num_entries entries, single precision.
+     *
+     * Backs the overloads that do not accept a user provided workspace; the buffer is
+     * allocated on the first call, grows when needed and is kept for the lifetime of
+     * the class, which avoids an allocation on every transform in time-stepping codes.
+     */
+    std::complex<float>* cached_workspace(size_t num_entries, std::complex<float>) const{
+        if (cache_workspace_single.size() < num_entries)
+            cache_workspace_single = make_buffer_container<std::complex<float>>(this->stream(), num_entries);
+        return cache_workspace_single.data();
+    }
+    //! \brief Returns the double precision persistent workspace buffer.
+    std::complex<double>* cached_workspace(size_t num_entries, std::complex<double>) const{
+        if (cache_workspace_double.size() < num_entries)
+            cache_workspace_double = make_buffer_container<std::complex<double>>(this->stream(), num_entries);
+        return cache_workspace_double.data();
+    }
+    //! \brief Real valued workspace for the r2r backends, aliases the complex buffer of the same precision.
+    float* cached_workspace(size_t num_entries, float) const{
+        return reinterpret_cast<float*>(cached_workspace((num_entries + 1) / 2, std::complex<float>()));
+    }
+    //! \brief Real valued workspace for the r2r backends, aliases the complex buffer of the same precision.
+    double* cached_workspace(size_t num_entries, double) const{
+        return reinterpret_cast<double*>(cached_workspace((num_entries + 1) / 2, std::complex<double>()));
+    }
+
+    //! \brief Indicates whether scaling is fused into the last executor stage (cpu backends only).
+    static constexpr bool fuses_scaling(){ return std::is_same<location_tag, tag::cpu>::value; }
+    //! \brief Returns the scale factor to fuse into the last executor, 1.0 when fusion is not used.
+    double fused_scale_factor(scale scaling) const{
+        return (fuses_scaling() and scaling != scale::none) ? get_scale_factor(scaling) : 1.0;
+    }
+
     //! \brief Applies the scaling factor to the data.
     template<typename scalar_type>
     void apply_scale(int const batch_size, direction dir, scale scaling, scalar_type data[]) const{
@@ -679,10 +767,14 @@ private:
 
     std::unique_ptr<box3d<index>> pinbox, poutbox; // inbox/output for this process
     double scale_factor;
+    double symmetric_scale_factor; // sqrt of the scale factor, computed during setup
     std::array<std::unique_ptr<reshape3d_base<index>>, 4> forward_shaper;
     std::array<std::unique_ptr<reshape3d_base<index>>, 4> backward_shaper;
 
     std::array<std::unique_ptr<executor_base>, 3> executors;
+    // lazily allocated buffers backing the overloads without a user provided workspace
+    mutable buffer_container<std::complex<float>> cache_workspace_single;
+    mutable buffer_container<std::complex<double>> cache_workspace_double;
     #ifdef Heffte_ENABLE_MAGMA
     gpu::magma_handle<typename backend::buffer_traits<backend_tag>::location> hmagma;
     #endif
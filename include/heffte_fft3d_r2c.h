@@ -149,8 +149,8 @@ public:
                    or (std::is_same<input_type, double>::value and is_zcomplex<output_type>::value),
                 "Using either an unknown complex type or an incompatible pair of types!");
 
-        auto workspace = make_buffer_container<output_type>(this->stream(), size_workspace());
-        forward(input, output, workspace.data(), scaling);
+        forward(input, output, reinterpret_cast<output_type*>(
+                    cached_workspace(size_workspace(), typename define_standard_type<output_type>::type())), scaling);
     }
 
     //! \brief Overload utilizing a user provided buffer.
@@ -163,8 +163,9 @@ public:
         compute_transform<location_tag, index>(this->stream(), 1, convert_to_standard(input), convert_to_standard(output),
                                                convert_to_standard(workspace),
                                                executor_buffer_offset, size_comm_buffers(), forward_shaper,
-                                               forward_executors(), direction::forward);
-        apply_scale(1, direction::forward, scaling, convert_to_standard(output));
+                                               forward_executors(), direction::forward, fused_scale_factor(scaling));
+        if (not fuses_scaling())
+            apply_scale(1, direction::forward, scaling, convert_to_standard(output));
     }
     //! \brief Overload utilizing a batch transform.
     template<typename input_type, typename output_type>
@@ -177,8 +178,9 @@ public:
         compute_transform<location_tag, index>(this->stream(), batch_size, convert_to_standard(input), convert_to_standard(output),
                                                convert_to_standard(workspace),
                                                executor_buffer_offset, size_comm_buffers(), forward_shaper,
-                                               forward_executors(), direction::forward);
-        apply_scale(batch_size, direction::forward, scaling, convert_to_standard(output));
+                                               forward_executors(), direction::forward, fused_scale_factor(scaling));
+        if (not fuses_scaling())
+            apply_scale(batch_size, direction::forward, scaling, convert_to_standard(output));
     }
     //! \brief Overload utilizing a batch transform using internally allocated workspace.
     template<typename input_type, typename output_type>
@@ -187,8 +189,8 @@ public:
                    or (std::is_same<input_type, double>::value and is_zcomplex<output_type>::value),
                 "Using either an unknown complex type or an incompatible pair of types!");
 
-        auto workspace = make_buffer_container<output_type>(this->stream(), batch_size * size_workspace());
-        forward(batch_size, input, output, workspace.data(), scaling);
+        forward(batch_size, input, output, reinterpret_cast<output_type*>(
+                    cached_workspace(batch_size * size_workspace(), typename define_standard_type<output_type>::type())), scaling);
     }
 
     /*!
@@ -237,8 +239,8 @@ public:
                    or (std::is_same<output_type, double>::value and is_zcomplex<input_type>::value),
                 "Using either an unknown complex type or an incompatible pair of types!");
 
-        auto workspace = make_buffer_container<input_type>(this->stream(), size_workspace());
-        backward(input, output, workspace.data(), scaling);
+        backward(input, output, reinterpret_cast<input_type*>(
+                     cached_workspace(size_workspace(), typename define_standard_type<input_type>::type())), scaling);
     }
 
     //! \brief Overload utilizing a user provided buffer.
@@ -251,8 +253,9 @@ public:
         compute_transform<location_tag, index>(this->stream(), 1, convert_to_standard(input), convert_to_standard(output),
                                                convert_to_standard(workspace),
                                                executor_buffer_offset, size_comm_buffers(), backward_shaper,
-                                               backward_executors(), direction::backward);
-        apply_scale(1, direction::backward, scaling, convert_to_standard(output));
+                                               backward_executors(), direction::backward, fused_scale_factor(scaling));
+        if (not fuses_scaling())
+            apply_scale(1, direction::backward, scaling, convert_to_standard(output));
     }
     //! \brief Overload that performs a batch transform.
     template<typename input_type, typename output_type>
@@ -265,8 +268,9 @@ public:
         compute_transform<location_tag, index>(this->stream(), batch_size, convert_to_standard(input), convert_to_standard(output),
                                                convert_to_standard(workspace),
                                                executor_buffer_offset, size_comm_buffers(), backward_shaper,
-                                               backward_executors(), direction::backward);
-        apply_scale(batch_size, direction::backward, scaling, convert_to_standard(output));
+                                               backward_executors(), direction::backward, fused_scale_factor(scaling));
+        if (not fuses_scaling())
+            apply_scale(batch_size, direction::backward, scaling, convert_to_standard(output));
     }
     //! \brief Overload that performs a batch transform using internally allocated workspace.
     template<typename input_type, typename output_type>
@@ -275,8 +279,8 @@ public:
                    or (std::is_same<output_type, double>::value and is_zcomplex<input_type>::value),
                 "Using either an unknown complex type or an incompatible pair of types!");
 
-        auto workspace = make_buffer_container<input_type>(this->stream(), batch_size * size_workspace());
-        backward(batch_size, input, output, workspace.data(), scaling);
+        backward(batch_size, input, output, reinterpret_cast<input_type*>(
+                     cached_workspace(batch_size * size_workspace(), typename define_standard_type<input_type>::type())), scaling);
     }
 
     /*!
@@ -291,16 +295,54 @@ public:
         return result;
     }
 
+    #ifdef Heffte_ENABLE_CUDA
+    /*!
+     * \brief Mixed-precision forward transform accepting half precision input (GPU backends only).
+     *
+     * The input is converted on the device to single precision and the transform,
+     * including the optional scaling, is computed entirely in single precision;
+     * only the initial read of the input uses the reduced precision,
+     * which halves the bandwidth of loading the input.
+     *
+     * \param input is an array of size at least size_inbox() of half precision entries
+     *          located on the GPU device
+     * \param output is an array of size at least size_outbox() and will be overwritten with
+     *          the result from the transform corresponding to the outbox
+     * \param scaling defines the type of scaling to apply (default no-scaling)
+     */
+    void forward(__half const input[], std::complex<float> output[], scale scaling = scale::none) const{
+        static_assert(std::is_same<location_tag, tag::gpu>::value,
+                      "Half precision input requires a GPU backend, e.g., cufft.");
+        auto single_input = make_buffer_container<float>(this->stream(), size_inbox());
+        cuda::convert(this->stream(), size_inbox(), input, single_input.data());
+        forward(single_input.data(), output, scaling);
+    }
+    /*!
+     * \brief Mixed-precision backward transform writing half precision output (GPU backends only).
+     *
+     * The transform and the optional scaling are computed in single precision
+     * and the result is converted to half precision in a final device kernel.
+     */
+    void backward(std::complex<float> const input[], __half output[], scale scaling = scale::none) const{
+        static_assert(std::is_same<location_tag, tag::gpu>::value,
+                      "Half precision output requires a GPU backend, e.g., cufft.");
+        auto single_output = make_buffer_container<float>(this->stream(), size_inbox());
+        backward(input, single_output.data(), scaling);
+        cuda::convert(this->stream(), size_inbox(), single_output.data(), output);
+    }
+    #endif
+
     /*!
      * \brief Returns the scale factor for the given scaling.
      */
-    double get_scale_factor(scale scaling) const{ return (scaling == scale::symmetric) ? std::sqrt(scale_factor) : scale_factor; }
+    double get_scale_factor(scale scaling) const{ return (scaling == scale::symmetric) ? symmetric_scale_factor : scale_factor; }
 
 private:
     //! \brief Same as in the fft3d case.
     fft3d_r2c(logic_plan3d<index> const &plan, MPI_Comm const comm) :
         pinbox(new box3d<index>(plan.in_shape[0][plan.mpi_rank])), poutbox(new box3d<index>(plan.out_shape[3][plan.mpi_rank])),
-        scale_factor(1.0 / static_cast<double>(plan.index_count))
+        scale_factor(1.0 / static_cast<double>(plan.index_count)),
+        symmetric_scale_factor(std::sqrt(scale_factor))
         #ifdef Heffte_ENABLE_MAGMA
         , hmagma(this->stream())
         #endif
@@ -313,7 +355,8 @@ private:
               logic_plan3d<index> const &plan, MPI_Comm const comm) :
         backend::device_instance<location_tag>(gpu_stream),
         pinbox(new box3d<index>(plan.in_shape[0][plan.mpi_rank])), poutbox(new box3d<index>(plan.out_shape[3][plan.mpi_rank])),
-        scale_factor(1.0 / static_cast<double>(plan.index_count))
+        scale_factor(1.0 / static_cast<double>(plan.index_count)),
+        symmetric_scale_factor(std::sqrt(scale_factor))
         #ifdef Heffte_ENABLE_MAGMA
         , hmagma(this->stream())
         #endif
@@ -323,6 +366,25 @@ private:
 
     //! \brief Setup the executors and the reshapes.
     void setup(logic_plan3d<index> const &plan, MPI_Comm const comm){
+        setup(plan, comm, backend::uses_internal_reshape<backend_tag>());
+    }
+    /*!
+     * \brief Setup variant for backends that handle the communication internally, e.g., cuFFTMp.
+     *
+     * The pencil/slab transposes happen inside the library plan, so no reshape
+     * stages are created and a single executor spans the entire transform.
+     */
+    void setup(logic_plan3d<index> const &plan, MPI_Comm const comm, std::true_type){
+        executors[0] = std::unique_ptr<executor_base>(new backend_executor_r2c(
+            this->stream(), comm, find_world(plan.in_shape[0]), *pinbox, *poutbox));
+
+        size_t executor_workspace_size = executors[0]->workspace_size();
+        comm_buffer_offset = 0;
+        size_buffer_work = static_cast<size_t>(poutbox->count()) + executor_workspace_size;
+        executor_buffer_offset = (executor_workspace_size == 0) ? 0 : poutbox->count();
+    }
+    //! \brief Setup variant using the heffte::reshape3d_base operations for the communication.
+    void setup(logic_plan3d<index> const &plan, MPI_Comm const comm, std::false_type){
         for(int i=0; i<4; i++){
             forward_shaper[i]    = make_reshape3d<backend_tag>(this->stream(), plan.in_shape[i], plan.out_shape[i], comm, plan.options);
             backward_shaper[3-i] = make_reshape3d<backend_tag>(this->stream(), plan.out_shape[i], plan.in_shape[i], comm, plan.options);
@@ -332,6 +394,23 @@ private:
         executors[1] = make_executor<backend_tag>(this->stream(), plan.out_shape[1][mpi::comm_rank(comm)], plan.fft_direction[1]);
         executors[2] = make_executor<backend_tag>(this->stream(), plan.out_shape[2][mpi::comm_rank(comm)], plan.fft_direction[2]);
 
+        // if no executor stage follows the last forward reshape, then the reshape writes the
+        // user output which will not be read again and the cpu packers can use streaming stores;
+        // note that shaper 0 of the forward transform writes into the workspace, never the output
+        int last = get_last_active(forward_shaper);
+        if (last >= 1){
+            bool executor_after = false;
+            for(int i=last; i<3; i++) executor_after = executor_after or (forward_executors()[i] != nullptr);
+            if (not executor_after) forward_shaper[last]->set_final_stage();
+        }
+        // the backward transform applies shaper 3 after the final complex-to-real executor
+        if (backward_shaper[3]) backward_shaper[3]->set_final_stage();
+
+        // compute_transform() completes deferred sends before the workspace is reused,
+        // so the reshapes can overlap the completion of the sends with the fft stages
+        for(auto &s : forward_shaper) if (s) s->set_deferred_sends();
+        for(auto &s : backward_shaper) if (s) s->set_deferred_sends();
+
         size_t executor_workspace_size = get_max_work_size(executors);
         comm_buffer_offset = std::max(get_workspace_size(forward_shaper), get_workspace_size(backward_shaper));
         size_buffer_work = comm_buffer_offset
@@ -347,6 +426,31 @@ private:
         return std::array<executor_base*, 3>{executors[2].get(), executors[1].get(), executors[0].get()};
     }
 
+    /*!
+     * \brief Returns a persistent workspace buffer with at least \b num_entries entries, single precision.
+     *
+     * Same as in the fft3d case, backs the overloads that do not accept a user provided
+     * workspace; allocated on first use, grows when needed and kept for the lifetime of the class.
+     */
+    std::complex<float>* cached_workspace(size_t num_entries, std::complex<float>) const{
+        if (cache_workspace_single.size() < num_entries)
+            cache_workspace_single = make_buffer_container<std::complex<float>>(this->stream(), num_entries);
+        return cache_workspace_single.data();
+    }
+    //! \brief Returns the double precision persistent workspace buffer.
+    std::complex<double>* cached_workspace(size_t num_entries, std::complex<double>) const{
+        if (cache_workspace_double.size() < num_entries)
+            cache_workspace_double = make_buffer_container<std::complex<double>>(this->stream(), num_entries);
+        return cache_workspace_double.data();
+    }
+
+    //! \brief Indicates whether scaling is fused into the last executor stage (cpu backends only).
+    static constexpr bool fuses_scaling(){ return std::is_same<location_tag, tag::cpu>::value; }
+    //! \brief Returns the scale factor to fuse into the last executor, 1.0 when fusion is not used.
+    double fused_scale_factor(scale scaling) const{
+        return (fuses_scaling() and scaling != scale::none) ? get_scale_factor(scaling) : 1.0;
+    }
+
     //! \brief Applies the scaling factor to the data.
     template<typename scalar_type>
     void apply_scale(int const batch_size, direction dir, scale scaling, scalar_type data[]) const{
@@ -367,10 +471,14 @@ private:
 
     std::unique_ptr<box3d<index>> pinbox, poutbox;
     double scale_factor;
+    double symmetric_scale_factor; // sqrt of the scale factor, computed during construction
     std::array<std::unique_ptr<reshape3d_base<index>>, 4> forward_shaper;
     std::array<std::unique_ptr<reshape3d_base<index>>, 4> backward_shaper;
 
     std::array<std::unique_ptr<executor_base>, 3> executors;
+    // lazily allocated buffers backing the overloads without a user provided workspace
+    mutable buffer_container<std::complex<float>> cache_workspace_single;
+    mutable buffer_container<std::complex<double>> cache_workspace_double;
     #ifdef Heffte_ENABLE_MAGMA
     gpu::magma_handle<location_tag> hmagma;
     #endif
@@ -401,6 +509,25 @@ fft3d_r2c<backend_tag, index> make_fft3d_r2c(box3d<index> const inbox, box3d<ind
     return fft3d_r2c<backend_tag, index>(inbox, outbox, r2c_direction, comm, options);
 }
 
+/*!
+ * \ingroup fft3d
+ * \brief Overload of make_fft3d_r2c() that accepts the r2c direction as a template parameter.
+ *
+ * Many applications, e.g., particle-in-cell or molecular dynamics codes, know the direction
+ * of the conjugate symmetry at compile time. This overload moves the validation of the
+ * direction from a runtime assert to a static_assert, the resulting object is identical
+ * to the one created by the runtime overload since the direction affects only the plan
+ * construction and does not appear in the per-transform call path.
+ */
+template<int r2c_direction, typename backend_tag, typename index>
+fft3d_r2c<backend_tag, index> make_fft3d_r2c(box3d<index> const inbox, box3d<index> const outbox,
+                                             MPI_Comm const comm,
+                                             plan_options const options = default_options<backend_tag>()){
+    static_assert(r2c_direction == 0 or r2c_direction == 1 or r2c_direction == 2,
+                  "the r2c_direction must be 0, 1 or 2");
+    return make_fft3d_r2c<backend_tag, index>(inbox, outbox, r2c_direction, comm, options);
+}
+
 }
 
 #endif
@@ -9,6 +9,11 @@
 
 #include "heffte_common.h"
 
+#include <cstring>
+#ifdef Heffte_ENABLE_AVX
+#include <immintrin.h>
+#endif
+
 /*!
  * \ingroup fft3d
  * \addtogroup hefftepacking Packing/Unpacking operations
@@ -64,6 +69,53 @@ inline std::ostream & operator << (std::ostream &os, pack_plan_3d<index> const &
     return os;
 }
 
+/*!
+ * \ingroup hefftepacking
+ * \brief Methods for copying data with non-temporal (streaming) stores.
+ *
+ * The final unpack of a transform writes the user output that will not be read
+ * again before it leaves the cache, e.g., until the next time-step of the application.
+ * Writing around the cache avoids the read-for-ownership traffic of regular stores
+ * and does not evict data that is still in use.
+ * The methods fall back to a regular copy when AVX has not been enabled.
+ */
+namespace nontemporal {
+    /*!
+     * \ingroup hefftepacking
+     * \brief Copy \b num_entries from \b source into \b destination bypassing the cache.
+     *
+     * The bulk of the copy uses streaming stores on the 32-byte aligned part of
+     * the destination, the remainders on either end use a regular copy.
+     * A call to flush() is required after the last copy of a batch.
+     */
+    template<typename scalar_type, typename index>
+    inline void copy_n(scalar_type const source[], index num_entries, scalar_type destination[]){
+        #ifdef Heffte_ENABLE_AVX
+        size_t num_bytes = static_cast<size_t>(num_entries) * sizeof(scalar_type);
+        char const *src = reinterpret_cast<char const*>(source);
+        char *dest = reinterpret_cast<char*>(destination);
+        size_t const head = std::min(num_bytes, (32 - reinterpret_cast<uintptr_t>(dest) % 32) % 32);
+        std::memcpy(dest, src, head);
+        size_t i = head;
+        for(; i + 32 <= num_bytes; i += 32)
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(dest + i),
+                                _mm256_loadu_si256(reinterpret_cast<__m256i const*>(src + i)));
+        std::memcpy(dest + i, src + i, num_bytes - i);
+        #else
+        std::copy_n(source, num_entries, destination);
+        #endif
+    }
+    /*!
+     * \ingroup hefftepacking
+     * \brief Makes the streaming stores visible to the other cores, call after the last copy_n().
+     */
+    inline void flush(){
+        #ifdef Heffte_ENABLE_AVX
+        _mm_sfence();
+        #endif
+    }
+}
+
 /*!
  * \ingroup hefftepacking
  * \brief The packer needs to know whether the data will be on the CPU or GPU devices.
@@ -87,6 +139,8 @@ template<typename mode> struct direct_packer{};
  * \brief Simple packer that copies sub-boxes without transposing the order of the indexes.
  */
 template<> struct direct_packer<tag::cpu>{
+    //! \brief Constructor, in non-temporal mode unpack() uses streaming stores.
+    direct_packer(bool use_nontemporal = false) : nontemporal_unpack(use_nontemporal){}
     //! \brief Execute the planned pack operation.
     template<typename scalar_type, typename index>
     void pack(void*, pack_plan_3d<index> const &plan, scalar_type const data[], scalar_type buffer[]) const{
@@ -100,13 +154,25 @@ template<> struct direct_packer<tag::cpu>{
     //! \brief Execute the planned unpack operation.
     template<typename scalar_type, typename index>
     void unpack(void*, pack_plan_3d<index> const &plan, scalar_type const buffer[], scalar_type data[]) const{
-        for(index slow = 0; slow < plan.size[2]; slow++){
-            for(index mid = 0; mid < plan.size[1]; mid++){
-                std::copy_n(&buffer[(slow * plan.size[1] + mid) * plan.size[0]],
-                            plan.size[0], &data[slow * plan.plane_stride + mid * plan.line_stride]);
+        if (nontemporal_unpack){
+            for(index slow = 0; slow < plan.size[2]; slow++){
+                for(index mid = 0; mid < plan.size[1]; mid++){
+                    nontemporal::copy_n(&buffer[(slow * plan.size[1] + mid) * plan.size[0]],
+                                        plan.size[0], &data[slow * plan.plane_stride + mid * plan.line_stride]);
+                }
+            }
+            nontemporal::flush();
+        }else{
+            for(index slow = 0; slow < plan.size[2]; slow++){
+                for(index mid = 0; mid < plan.size[1]; mid++){
+                    std::copy_n(&buffer[(slow * plan.size[1] + mid) * plan.size[0]],
+                                plan.size[0], &data[slow * plan.plane_stride + mid * plan.line_stride]);
+                }
             }
         }
     }
+    //! \brief When set, the unpack() stores bypass the cache, used for the final stage of a transform.
+    bool const nontemporal_unpack;
 };
 
 /*!
@@ -120,6 +186,8 @@ template<typename mode> struct transpose_packer{};
  * \brief Transpose packer that packs sub-boxes without transposing, but unpacks applying a transpose operation.
  */
 template<> struct transpose_packer<tag::cpu>{
+    //! \brief Constructor, the non-temporal mode applies only to the contiguous lines of unpack().
+    transpose_packer(bool use_nontemporal = false) : nontemporal_unpack(use_nontemporal){}
     //! \brief Execute the planned pack operation.
     template<typename scalar_type, typename index>
     void pack(void *q, pack_plan_3d<index> const &plan, scalar_type const data[], scalar_type buffer[]) const{
@@ -135,11 +203,21 @@ template<> struct transpose_packer<tag::cpu>{
     void unpack(void*, pack_plan_3d<index> const &plan, scalar_type const buffer[], scalar_type data[]) const{
         constexpr index stride = 256 / sizeof(scalar_type);
         if (plan.map[0] == 0 and plan.map[1] == 1){
-            for(index i=0; i<plan.size[2]; i++)
-                for(index j=0; j<plan.size[1]; j++)
-                    for(index k=0; k<plan.size[0]; k++)
-                        data[i * plan.plane_stride + j * plan.line_stride + k]
-                            = buffer[ i * plan.buff_plane_stride + j * plan.buff_line_stride + k ];
+            // only this case writes whole contiguous lines and can stream around the cache,
+            // the transposing cases scatter the stores and use the regular write path
+            if (nontemporal_unpack){
+                for(index i=0; i<plan.size[2]; i++)
+                    for(index j=0; j<plan.size[1]; j++)
+                        nontemporal::copy_n(&buffer[ i * plan.buff_plane_stride + j * plan.buff_line_stride ],
+                                            plan.size[0], &data[i * plan.plane_stride + j * plan.line_stride]);
+                nontemporal::flush();
+            }else{
+                for(index i=0; i<plan.size[2]; i++)
+                    for(index j=0; j<plan.size[1]; j++)
+                        for(index k=0; k<plan.size[0]; k++)
+                            data[i * plan.plane_stride + j * plan.line_stride + k]
+                                = buffer[ i * plan.buff_plane_stride + j * plan.buff_line_stride + k ];
+            }
 
         }else if (plan.map[0] == 0 and plan.map[1] == 2){
             for(index bi=0; bi<plan.size[2]; bi+=stride)
@@ -194,6 +272,8 @@ template<> struct transpose_packer<tag::cpu>{
         }
 
     }
+    //! \brief When set, the contiguous stores of unpack() bypass the cache, used for the final stage of a transform.
+    bool const nontemporal_unpack;
 };
 
 /*!
@@ -53,7 +53,11 @@ enum class reshape_algorithm{
     //! \brief Using MPI_Isend and MPI_Irecv, all sending receiving packing and unpacking are pipelined.
     p2p_plined = 1,
     //! \brief Using MPI_Send and MPI_Irecv, receive is pipelined with packing and sending.
-    p2p = 2
+    p2p = 2,
+    //! \brief Using MPI_Neighbor_alltoallv over a graph communicator connecting only the ranks that exchange data.
+    neighbor_alltoallv = 4,
+    //! \brief Using a shared memory window for the messages between ranks on the same node, MPI point-to-point otherwise (CPU backends).
+    shared_memory = 5
 };
 
 /*!
@@ -186,6 +190,8 @@ inline std::ostream & operator << (std::ostream &os, plan_options const options)
         case reshape_algorithm::alltoall   : algorithm = "mpi:alltoall"; break;
         case reshape_algorithm::p2p_plined : algorithm = "mpi:point-to-point-pipelined"; break;
         case reshape_algorithm::p2p        : algorithm = "mpi:point-to-point"; break;
+        case reshape_algorithm::neighbor_alltoallv : algorithm = "mpi:neighbor-alltoallv"; break;
+        case reshape_algorithm::shared_memory : algorithm = "mpi:shared-memory"; break;
     };
     os << "options = ("
        << ((options.use_reorder) ? "fft1d:contiguous" : "fft1d:strided") << ", "
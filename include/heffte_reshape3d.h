@@ -60,7 +60,8 @@ template<typename index>
 class reshape3d_base{
 public:
     //! \brief Constructor that sets the input and output sizes.
-    reshape3d_base(index cinput_size, index coutput_size) : input_size(cinput_size), output_size(coutput_size){};
+    reshape3d_base(index cinput_size, index coutput_size) :
+        input_size(cinput_size), output_size(coutput_size), final_stage(false), deferred_sends(false){};
     //! \brief Default virtual destructor.
     virtual ~reshape3d_base() = default;
     //! \brief Apply the reshape, single precision.
@@ -79,11 +80,41 @@ public:
     //! \brief Returns the workspace size.
     virtual size_t size_workspace() const{ return input_size + output_size; }
 
+    /*!
+     * \brief Marks the reshape as the final stage of a transform.
+     *
+     * The destination of the final stage is the user output, which will not be
+     * read again by heFFTe, hence the cpu packers can use non-temporal stores.
+     * Set during plan setup only when no fft executor follows the reshape.
+     */
+    void set_final_stage(){ final_stage = true; }
+    //! \brief Returns true when the reshape writes the user output of a transform.
+    bool is_final_stage() const{ return final_stage; }
+
+    /*!
+     * \brief Allows apply() to return with the outgoing send messages still in flight.
+     *
+     * The result of the reshape depends only on the received data, hence the completion
+     * of the sends can overlap with the fft stage that follows the reshape.
+     * The deferred messages read from the workspace, so wait_sends() must be called
+     * before the workspace is reused; compute_transform() handles this and never
+     * returns with sends in flight, thus the flag is set during plan setup only.
+     */
+    void set_deferred_sends(){ deferred_sends = true; }
+    //! \brief Returns true when apply() is allowed to defer the completion of the sends.
+    bool uses_deferred_sends() const{ return deferred_sends; }
+    //! \brief Completes the outstanding sends from a previous apply(), no-op unless deferred sends are used.
+    virtual void wait_sends() const{}
+
 protected:
     //! \brief Stores the size of the input.
     index const input_size;
     //! \brief Stores the size of the output.
     index const output_size;
+    //! \brief When set, the unpack into the destination can bypass the cache.
+    bool final_stage;
+    //! \brief When set, apply() may leave the outgoing sends pending until wait_sends().
+    bool deferred_sends;
 
     // buffers to be used in the no-gpu-aware algorithm for the temporary cpu storage
     // the no-gpu-aware version alleviate the latency when working with small FFTs
@@ -327,6 +358,107 @@ make_reshape3d_alltoallv(typename backend::device_instance<location_tag>::stream
                          bool use_gpu_aware,
                          MPI_Comm const comm);
 
+/*!
+ * \ingroup hefftereshape
+ * \brief Reshape algorithm based on the MPI_Neighbor_alltoallv() method.
+ *
+ * The ranks that exchange data are connected into a distributed graph communicator
+ * created with MPI_Dist_graph_create_adjacent() and the data movement is done with
+ * a single neighborhood collective call, which informs MPI of the exact
+ * communication pattern and avoids the overhead of the ranks that hold no
+ * overlapping boxes. The packing and unpacking logic is identical to that of
+ * heffte::reshape3d_alltoallv, an instance of the class can be created only via
+ * the factory method heffte::make_reshape3d_neighbor().
+ *
+ * \tparam location_tag is the location of the input/output buffers, tag::cpu or tag::gpu
+ * \tparam packer the packer algorithms to use in arranging the sub-boxes into the global send/recv buffer,
+ *         will work with either heffte::direct_packer or heffte::transpose_packer
+ */
+template<typename location_tag, template<typename device> class packer, typename index>
+class reshape3d_neighbor : public reshape3d_base<index>, public backend::device_instance<location_tag>{
+public:
+    //! \brief Destructor, frees the graph comm generated by the factory.
+    ~reshape3d_neighbor(){ mpi::comm_free(comm); }
+    //! \brief Factory method, use to construct instances of the class.
+    template<typename b, template<typename d> class p, typename i> friend std::unique_ptr<reshape3d_neighbor<b, p, i>>
+    make_reshape3d_neighbor(typename backend::device_instance<b>::stream_type, std::vector<box3d<i>> const&, std::vector<box3d<i>> const&, bool, MPI_Comm const);
+
+    //! \brief Apply the reshape operations, single precision overload.
+    void apply(int batch_size, float const source[], float destination[], float workspace[]) const override final{
+        apply_base(batch_size, source, destination, workspace);
+    }
+    //! \brief Apply the reshape operations, double precision overload.
+    void apply(int batch_size, double const source[], double destination[], double workspace[]) const override final{
+        apply_base(batch_size, source, destination, workspace);
+    }
+    //! \brief Apply the reshape operations, single precision complex overload.
+    void apply(int batch_size, std::complex<float> const source[], std::complex<float> destination[], std::complex<float> workspace[]) const override final{
+        apply_base(batch_size, source, destination, workspace);
+    }
+    //! \brief Apply the reshape operations, double precision complex overload.
+    void apply(int batch_size, std::complex<double> const source[], std::complex<double> destination[], std::complex<double> workspace[]) const override final{
+        apply_base(batch_size, source, destination, workspace);
+    }
+
+    //! \brief Templated reshape3d_neighbor::apply() algorithm for all scalar types.
+    template<typename scalar_type>
+    void apply_base(int batch_size, scalar_type const source[], scalar_type destination[], scalar_type workspace[]) const;
+
+private:
+    /*!
+     * \brief Private constructor that accepts a set of arrays that have been pre-computed by the factory.
+     */
+    reshape3d_neighbor(typename backend::device_instance<location_tag>::stream_type q,
+                       int input_size, int output_size, bool gpu_aware, MPI_Comm graph_comm,
+                       std::vector<int> &&send_offset, std::vector<int> &&send_size, std::vector<int> &&send_displ,
+                       std::vector<int> &&recv_offset, std::vector<int> &&recv_size, std::vector<int> &&recv_displ,
+                       std::vector<pack_plan_3d<index>> &&packplan, std::vector<pack_plan_3d<index>> &&unpackplan);
+
+    MPI_Comm const comm;
+    int const me, nprocs;
+    bool const use_gpu_aware;
+
+    std::vector<int> const send_offset;   // extraction loc for each send
+    std::vector<int> const send_size;     // size of each send message
+    std::vector<int> const send_displ;    // loc of each message within the send buffer
+    std::vector<int> const recv_offset;   // insertion loc for each recv
+    std::vector<int> const recv_size;     // size of each recv message
+    std::vector<int> const recv_displ;    // loc of each message within the recv buffer
+    int const send_total, recv_total;
+
+    std::vector<pack_plan_3d<index>> const packplan, unpackplan;
+};
+
+/*!
+ * \ingroup hefftereshape
+ * \brief Factory method that all the necessary work to establish the communication patterns.
+ *
+ * The purpose of the factory method is to isolate the initialization code and ensure that the internal
+ * state of the class is minimal and const-correct, i.e., objects do not hold onto data that will not be
+ * used in a reshape apply and the data is labeled const to prevent accidental corruption.
+ *
+ * \tparam location_tag the location of the input/output buffers, tag::cpu or tag::gpu
+ * \tparam packer is the packer to use to parts of boxes into global send/recv buffer
+ *
+ * \param q device stream
+ * \param input_boxes list of all input boxes across all ranks in the comm
+ * \param output_boxes list of all output boxes across all ranks in the comm
+ * \param use_gpu_aware use MPI calls directly from the GPU (GPU backends only)
+ * \param comm the communicator associated with all the boxes
+ *
+ * \returns unique_ptr containing an instance of the heffte::reshape3d_neighbor
+ *
+ * Note: the input and output boxes associated with this rank are located at position
+ * mpi::comm_rank() in the respective lists.
+ */
+template<typename location_tag, template<typename device> class packer = direct_packer, typename index>
+std::unique_ptr<reshape3d_neighbor<location_tag, packer, index>>
+make_reshape3d_neighbor(typename backend::device_instance<location_tag>::stream_type q,
+                        std::vector<box3d<index>> const &input_boxes,
+                        std::vector<box3d<index>> const &output_boxes,
+                        bool use_gpu_aware,
+                        MPI_Comm const comm);
+
 /*!
  * \ingroup hefftereshape
  * \brief Reshape algorithm based on the MPI_Send() and MPI_Irecv() methods.
@@ -363,6 +495,11 @@ public:
         apply_base(batch_size, source, destination, workspace);
     }
 
+    //! \brief Completes the sends left in flight when deferred sends are enabled.
+    void wait_sends() const override final{
+        MPI_Waitall(static_cast<int>(isends.size()), isends.data(), MPI_STATUS_IGNORE);
+    }
+
     //! \brief Templated reshape3d_pointtopoint::apply() algorithm for all scalar types.
     template<typename scalar_type>
     void apply_base(int batch_size, scalar_type const source[], scalar_type destination[], scalar_type workspace[]) const;
@@ -434,6 +571,135 @@ make_reshape3d_pointtopoint(typename backend::device_instance<location_tag>::str
                             reshape_algorithm algorithm, bool use_gpu_aware,
                             MPI_Comm const comm);
 
+/*!
+ * \ingroup hefftereshape
+ * \brief Reshape algorithm that short-circuits the intra-node messages through a shared memory window.
+ *
+ * At construction time, the ranks are split into node-local groups with
+ * MPI_Comm_split_type(MPI_COMM_TYPE_SHARED) and each rank allocates a segment of a shared
+ * window with MPI_Win_allocate_shared(). A message between two ranks on the same node is
+ * packed by the sender directly into its window segment and unpacked by the receiver directly
+ * from there, which removes the user-to-kernel-to-user copy performed by the MPI point-to-point
+ * calls. The pairs synchronize with zero-size ready/ack messages, hence the apply is not
+ * a collective operation and ranks with an empty reshape never enter the exchange
+ * (same as the point-to-point variants). Messages between ranks on different nodes use
+ * the same MPI calls as heffte::reshape3d_pointtopoint.
+ *
+ * The shared window resides in host memory, thus the class handles only cpu buffers;
+ * heffte::make_reshape3d() falls back to the point-to-point variant for the gpu backends.
+ * The window is sized for a single transform, batched calls also fall back to point-to-point.
+ *
+ * \tparam location_tag must be tag::cpu
+ * \tparam packer the packer algorithms to use in arranging the sub-boxes into the global send/recv buffer
+ */
+template<typename location_tag, template<typename device> class packer, typename index>
+class reshape3d_shared : public reshape3d_base<index>, public backend::device_instance<location_tag>{
+public:
+    //! \brief Destructor, frees the shared window and the node-local comm.
+    ~reshape3d_shared(){
+        if (window != MPI_WIN_NULL){
+            MPI_Win_unlock_all(window);
+            MPI_Win_free(&window);
+        }
+        mpi::comm_free(node_comm);
+    }
+    //! \brief Factory method, use to construct instances of the class.
+    template<typename b, template<typename d> class p, typename i> friend std::unique_ptr<reshape3d_shared<b, p, i>>
+    make_reshape3d_shared(typename backend::device_instance<b>::stream_type, std::vector<box3d<i>> const&, std::vector<box3d<i>> const&, bool, MPI_Comm const);
+
+    //! \brief Apply the reshape operations, single precision overload.
+    void apply(int batch_size, float const source[], float destination[], float workspace[]) const override final{
+        apply_base(batch_size, source, destination, workspace);
+    }
+    //! \brief Apply the reshape operations, double precision overload.
+    void apply(int batch_size, double const source[], double destination[], double workspace[]) const override final{
+        apply_base(batch_size, source, destination, workspace);
+    }
+    //! \brief Apply the reshape operations, single precision complex overload.
+    void apply(int batch_size, std::complex<float> const source[], std::complex<float> destination[], std::complex<float> workspace[]) const override final{
+        apply_base(batch_size, source, destination, workspace);
+    }
+    //! \brief Apply the reshape operations, double precision complex overload.
+    void apply(int batch_size, std::complex<double> const source[], std::complex<double> destination[], std::complex<double> workspace[]) const override final{
+        apply_base(batch_size, source, destination, workspace);
+    }
+
+    //! \brief Templated reshape3d_shared::apply() algorithm for all scalar types.
+    template<typename scalar_type>
+    void apply_base(int batch_size, scalar_type const source[], scalar_type destination[], scalar_type workspace[]) const;
+
+private:
+    /*!
+     * \brief Private constructor that accepts a set of arrays that have been pre-computed by the factory.
+     */
+    reshape3d_shared(typename backend::device_instance<location_tag>::stream_type q,
+                     int input_size, int output_size, MPI_Comm ccomm, MPI_Comm cnode_comm, MPI_Win cwindow, char *cwindow_base,
+                     std::vector<int> &&send_offset, std::vector<int> &&send_size, std::vector<int> &&send_proc,
+                     std::vector<int> &&send_displ, std::vector<int> &&send_window,
+                     std::vector<int> &&recv_offset, std::vector<int> &&recv_size, std::vector<int> &&recv_proc,
+                     std::vector<int> &&recv_loc, std::vector<int> &&peer_displ, std::vector<char*> &&peer_base,
+                     std::vector<pack_plan_3d<index>> &&packplan, std::vector<pack_plan_3d<index>> &&unpackplan);
+
+    MPI_Comm const comm;
+    int const me, nprocs;
+    bool const self_to_self;
+    MPI_Comm node_comm;
+    MPI_Win window;
+    char* const window_base;
+
+    std::vector<int> const send_proc;     // processor to send towards
+    std::vector<int> const send_offset;   // extraction loc for each send
+    std::vector<int> const send_size;     // size of each send message
+    std::vector<int> const send_displ;    // loc of each message within this window segment
+    std::vector<int> const send_window;   // one for the messages that go through the window
+    std::vector<int> const recv_proc;     // processor to receive from
+    std::vector<int> const recv_offset;   // insertion loc for each recv
+    std::vector<int> const recv_size;     // size of each recv message
+    std::vector<int> const recv_loc;      // offset in the receive buffer (recv_offset refers to the the destination buffer)
+    std::vector<int> const peer_displ;    // loc of each message within the sender's window segment
+    std::vector<char*> const peer_base;   // window segment of the sending rank, nullptr for off-node receives
+    int const send_total, recv_total;
+
+    std::vector<pack_plan_3d<index>> const packplan, unpackplan;
+
+    mutable std::vector<MPI_Request> requests; // one request for each (payload or ready) receive
+    mutable std::vector<MPI_Request> acks;     // acks from the window receivers towards this rank
+    mutable std::vector<MPI_Request> isends;   // ready or ack notifications sent by this rank
+};
+
+/*!
+ * \ingroup hefftereshape
+ * \brief Factory method that all the necessary work to establish the communication patterns.
+ *
+ * The purpose of the factory method is to isolate the initialization code and ensure that the internal
+ * state of the class is minimal and const-correct, i.e., objects do not hold onto data that will not be
+ * used in a reshape apply and the data is labeled const to prevent accidental corruption.
+ *
+ * The method is collective over the comm, it splits the node-local sub-communicators
+ * and allocates the shared memory window.
+ *
+ * \tparam location_tag must be tag::cpu, the shared window resides in host memory
+ * \tparam packer is the packer to use to parts of boxes into global send/recv buffer
+ *
+ * \param q device stream
+ * \param input_boxes list of all input boxes across all ranks in the comm
+ * \param output_boxes list of all output boxes across all ranks in the comm
+ * \param use_gpu_aware unused, accepted for consistency with the other factories
+ * \param comm the communicator associated with all the boxes
+ *
+ * \returns unique_ptr containing an instance of the heffte::reshape3d_shared
+ *
+ * Note: the input and output boxes associated with this rank are located at position
+ * mpi::comm_rank() in the respective lists.
+ */
+template<typename location_tag, template<typename device> class packer = direct_packer, typename index>
+std::unique_ptr<reshape3d_shared<location_tag, packer, index>>
+make_reshape3d_shared(typename backend::device_instance<location_tag>::stream_type q,
+                      std::vector<box3d<index>> const &input_boxes,
+                      std::vector<box3d<index>> const &output_boxes,
+                      bool use_gpu_aware,
+                      MPI_Comm const comm);
+
 /*!
  * \ingroup hefftereshape
  * \brief Special case of the reshape that does not involve MPI communication but applies a transpose instead.
@@ -474,11 +740,11 @@ private:
         if (source == destination){ // in-place transpose will need workspace
             backend::data_manipulator<location_tag>::copy_n(this->stream(), source, batch_size * this->input_size, workspace);
             for(int j=0; j<batch_size; j++)
-                transpose_packer<location_tag>().unpack(this->stream(), plan, workspace + j * this->input_size,
+                transpose_packer<location_tag>(this->is_final_stage()).unpack(this->stream(), plan, workspace + j * this->input_size,
                                                         destination + j * this->input_size);
         }else{
             for(int j=0; j<batch_size; j++)
-                transpose_packer<location_tag>().unpack(this->stream(), plan, source + j * this->input_size,
+                transpose_packer<location_tag>(this->is_final_stage()).unpack(this->stream(), plan, source + j * this->input_size,
                                                         destination + j * this->input_size);
         }
     }
@@ -486,6 +752,41 @@ private:
     pack_plan_3d<index> const plan;
 };
 
+/*!
+ * \ingroup hefftereshape
+ * \brief Creates the shared memory reshape, the window resides in host memory so cpu buffers only.
+ */
+template<typename location_tag, typename index>
+std::unique_ptr<reshape3d_base<index>>
+make_reshape3d_shared_dispatch(typename backend::device_instance<location_tag>::stream_type stream,
+                               std::vector<box3d<index>> const &input_boxes, std::vector<box3d<index>> const &output_boxes,
+                               plan_options const options, MPI_Comm const comm, tag::cpu){
+    if (input_boxes[0].ordered_same_as(output_boxes[0])){
+        return make_reshape3d_shared<location_tag, direct_packer, index>(stream, input_boxes, output_boxes,
+                                                                         options.use_gpu_aware, comm);
+    }else{
+        return make_reshape3d_shared<location_tag, transpose_packer, index>(stream, input_boxes, output_boxes,
+                                                                            options.use_gpu_aware, comm);
+    }
+}
+/*!
+ * \ingroup hefftereshape
+ * \brief Overload for the gpu case, falls back to the point-to-point reshape.
+ */
+template<typename location_tag, typename index>
+std::unique_ptr<reshape3d_base<index>>
+make_reshape3d_shared_dispatch(typename backend::device_instance<location_tag>::stream_type stream,
+                               std::vector<box3d<index>> const &input_boxes, std::vector<box3d<index>> const &output_boxes,
+                               plan_options const options, MPI_Comm const comm, tag::gpu){
+    if (input_boxes[0].ordered_same_as(output_boxes[0])){
+        return make_reshape3d_pointtopoint<location_tag, direct_packer, index>(stream, input_boxes, output_boxes,
+                                                                               reshape_algorithm::p2p, options.use_gpu_aware, comm);
+    }else{
+        return make_reshape3d_pointtopoint<location_tag, transpose_packer, index>(stream, input_boxes, output_boxes,
+                                                                                  reshape_algorithm::p2p, options.use_gpu_aware, comm);
+    }
+}
+
 /*!
  * \ingroup hefftereshape
  * \brief Factory method to create a reshape3d instance.
@@ -543,6 +844,17 @@ std::unique_ptr<reshape3d_base<index>> make_reshape3d(typename backend::device_i
                 return make_reshape3d_alltoall<location_tag, transpose_packer, index>(stream, input_boxes, output_boxes,
                                                                                       options.use_gpu_aware, comm);
             }
+        }else if (options.algorithm == reshape_algorithm::neighbor_alltoallv){
+            if (input_boxes[0].ordered_same_as(output_boxes[0])){
+                return make_reshape3d_neighbor<location_tag, direct_packer, index>(stream, input_boxes, output_boxes,
+                                                                                   options.use_gpu_aware, comm);
+            }else{
+                return make_reshape3d_neighbor<location_tag, transpose_packer, index>(stream, input_boxes, output_boxes,
+                                                                                      options.use_gpu_aware, comm);
+            }
+        }else if (options.algorithm == reshape_algorithm::shared_memory){
+            return make_reshape3d_shared_dispatch<location_tag, index>(stream, input_boxes, output_boxes,
+                                                                       options, comm, location_tag());
         }else{
             if (input_boxes[0].ordered_same_as(output_boxes[0])){
                 return make_reshape3d_pointtopoint<location_tag, direct_packer, index>(stream, input_boxes, output_boxes,
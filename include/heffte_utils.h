@@ -395,6 +395,40 @@ int count_active(std::array<std::unique_ptr<some_class>, 4> const &shaper){
     return num;
 }
 
+/*!
+ * \ingroup fft3dmisc
+ * \brief Return the index of the last active (non-null) executor.
+ *
+ * The method returns -1 if all executors are null.
+ */
+template<typename some_class>
+int get_last_executor(std::array<some_class, 3> const &executors){
+    int last = -1;
+    for(int i=0; i<3; i++) if (executors[i] != nullptr) last = i;
+    return last;
+}
+
+/*!
+ * \ingroup fft3dmisc
+ * \brief Return the executor stage where a scaling factor can be fused, -1 if no local stage qualifies.
+ *
+ * The choice of stage must be consistent across the ranks of the communicator,
+ * since entries migrate between the ranks at the reshape operations in-between
+ * the executor stages. An executor can be missing (null) either on all ranks,
+ * when stages are merged into a higher dimensional transform, or only locally,
+ * when the rank holds an empty box. The last stage is always safe when present;
+ * otherwise the last local stage qualifies only if no reshapes separate the
+ * executor stages, i.e., no entries migrate mid-transform. A rank with no
+ * qualifying stage holds no entries at the last stage and the corresponding
+ * entries are scaled by the ranks that hold them.
+ */
+template<typename exec_class, typename shaper_class>
+int get_scaled_stage(std::array<exec_class, 3> const &executors, std::array<shaper_class, 4> const &shapers){
+    if (executors[2] != nullptr) return 2;
+    if (not shapers[1] and not shapers[2]) return get_last_executor(executors);
+    return -1;
+}
+
 /*!
  * \ingroup fft3dmisc
  * \brief Returns the max of the box_size() for each of the executors.
@@ -39,8 +39,24 @@ struct omega {
     }
 };
 
+/*! \ingroup stockbackend
+ * \brief Fill a table with the first twiddle factor of each recursion level
+ *
+ * The radix kernels only need omega(1, N') for each sub-problem size
+ * N' = N, N/radix, ..., radix; the remaining factors are formed by cheap
+ * products. The table is computed once at plan time in the forward
+ * direction and conjugated on the fly for the backward transform.
+ */
+template<typename F, int L>
+inline void fill_level_twiddles(size_t N, size_t radix, Complex<F,L>* twiddles) {
+    size_t lvl = 0;
+    for(size_t n = N; n >= radix; n /= radix) {
+        twiddles[lvl++] = omega<F,L>::get(1, n, direction::forward);
+    }
+}
+
 //! \brief Enumeration to represent which FFT type to use
-enum fft_type {pow2, pow3, pow4, composite, discrete, rader};
+enum fft_type {pow2, pow3, pow4, pow5, composite, discrete, rader};
 
 /*! \ingroup stockbackend
  * \brief Functor class to represent any Fourier Transform
@@ -60,6 +76,7 @@ class Fourier_Transform {
                 case fft_type::pow2: pow2_FFT(x, y, s_in, s_out, sRoot, dir); break;
                 case fft_type::pow3: pow3_FFT(x, y, s_in, s_out, sRoot, dir); break;
                 case fft_type::pow4: pow4_FFT(x, y, s_in, s_out, sRoot, dir); break;
+                case fft_type::pow5: pow5_FFT(x, y, s_in, s_out, sRoot, dir); break;
                 case fft_type::composite: composite_FFT(x, y, s_in, s_out, sRoot, dir); break;
                 case fft_type::discrete: DFT(x, y, s_in, s_out, sRoot, dir); break;
                 case fft_type::rader: rader_FFT(x, y, s_in, s_out, sRoot, dir, root, root_inv); break;
@@ -134,9 +151,10 @@ inline void DFT(Complex<F,L>* x, Complex<F,L>* y, size_t s_in, size_t s_out, biF
     DFT_helper(sLeaf->sz, x, y, s_in, s_out, dir);
 }
 
-// Recursive helper function implementing a classic C-T FFT
+// Recursive helper function implementing a classic C-T FFT,
+// twiddles holds the precomputed forward twiddle factor of each recursion level
 template<typename F, int L>
-inline void pow2_FFT_helper(size_t N, Complex<F,L>* x, Complex<F,L>* y, size_t s_in, size_t s_out, direction dir) {
+inline void pow2_FFT_helper(size_t N, Complex<F,L>* x, Complex<F,L>* y, size_t s_in, size_t s_out, direction dir, Complex<F,L> const *twiddles) {
     // Trivial case
     if(N == 2) {
         y[    0] = x[0] + x[s_in];
@@ -148,11 +166,12 @@ inline void pow2_FFT_helper(size_t N, Complex<F,L>* x, Complex<F,L>* y, size_t s
     int m = N/2;
 
     // Divide into two sub-problems
-    pow2_FFT_helper(m, x, y, s_in*2, s_out, dir);
-    pow2_FFT_helper(m, x+s_in, y+s_out*m, s_in*2, s_out, dir);
+    pow2_FFT_helper(m, x, y, s_in*2, s_out, dir, twiddles + 1);
+    pow2_FFT_helper(m, x+s_in, y+s_out*m, s_in*2, s_out, dir, twiddles + 1);
 
     // Twiddle Factor
-    Complex<F,L> w1 = omega<F,L>::get(1, N, dir);
+    Complex<F,L> w1 = twiddles[0];
+    if(dir == direction::backward) w1 = w1.conjugate();
     Complex<F,L> wj = w1;
     Complex<F,L> y_j = y[0];
 
@@ -174,12 +193,13 @@ inline void pow2_FFT_helper(size_t N, Complex<F,L>* x, Complex<F,L>* y, size_t s
 template<typename F, int L>
 inline void pow2_FFT(Complex<F,L>* x, Complex<F,L>* y, size_t s_in, size_t s_out, biFuncNode<F,L>* sRoot, direction dir) {
     const size_t N = sRoot->sz; // Size of problem
-    pow2_FFT_helper(N, x, y, s_in, s_out, dir); // Call the radix-2 FFT
+    pow2_FFT_helper(N, x, y, s_in, s_out, dir, sRoot->workspace.data()); // Call the radix-2 FFT
 }
 
-// Recursive helper function implementing a classic C-T FFT
+// Recursive helper function implementing a classic C-T FFT,
+// twiddles holds the precomputed forward twiddle factor of each recursion level
 template<typename F, int L>
-inline void pow4_FFT_helper(size_t N, Complex<F,L>* x, Complex<F,L>* y, size_t s_in, size_t s_out, direction dir) {
+inline void pow4_FFT_helper(size_t N, Complex<F,L>* x, Complex<F,L>* y, size_t s_in, size_t s_out, direction dir, Complex<F,L> const *twiddles) {
     // Trivial case
     if(N == 4) {
         if(dir == direction::forward) {
@@ -200,13 +220,14 @@ inline void pow4_FFT_helper(size_t N, Complex<F,L>* x, Complex<F,L>* y, size_t s
     int m = N/4;
 
     // Divide into two sub-problems
-    pow4_FFT_helper(m, x         , y            , s_in*4, s_out, dir);
-    pow4_FFT_helper(m, x +   s_in, y +   s_out*m, s_in*4, s_out, dir);
-    pow4_FFT_helper(m, x + 2*s_in, y + 2*s_out*m, s_in*4, s_out, dir);
-    pow4_FFT_helper(m, x + 3*s_in, y + 3*s_out*m, s_in*4, s_out, dir);
+    pow4_FFT_helper(m, x         , y            , s_in*4, s_out, dir, twiddles + 1);
+    pow4_FFT_helper(m, x +   s_in, y +   s_out*m, s_in*4, s_out, dir, twiddles + 1);
+    pow4_FFT_helper(m, x + 2*s_in, y + 2*s_out*m, s_in*4, s_out, dir, twiddles + 1);
+    pow4_FFT_helper(m, x + 3*s_in, y + 3*s_out*m, s_in*4, s_out, dir, twiddles + 1);
 
     // Twiddle Factors
-    Complex<F,L> w1 = omega<F,L>::get(1,N,dir);
+    Complex<F,L> w1 = twiddles[0];
+    if(dir == direction::backward) w1 = w1.conjugate();
     Complex<F,L> w2 = w1*w1;
     Complex<F,L> w3 = w2*w1;
     Complex<F,L> wk1 = w1; Complex<F,L> wk2 = w2; Complex<F,L> wk3 = w3;
@@ -267,7 +288,7 @@ inline void pow4_FFT_helper(size_t N, Complex<F,L>* x, Complex<F,L>* y, size_t s
 template<typename F, int L>
 inline void pow4_FFT(Complex<F,L>* x, Complex<F,L>* y, size_t s_in, size_t s_out, biFuncNode<F,L>* sRoot, direction dir) {
     const size_t N = sRoot->sz; // Size of problem
-    pow4_FFT_helper(N, x, y, s_in, s_out, dir); // Call the radix-2 FFT
+    pow4_FFT_helper(N, x, y, s_in, s_out, dir, sRoot->workspace.data()); // Call the radix-4 FFT
 }
 
 // External & Internal function for radix-N1 C-T FFTs
@@ -377,9 +398,10 @@ inline void rader_FFT(Complex<F,L>* x, Complex<F,L>* y, size_t s_in, size_t s_ou
     }
 }
 
-// Internal recursive helper-function that calculates the FFT of a signal with length 3^k
+// Internal recursive helper-function that calculates the FFT of a signal with length 3^k,
+// twiddles holds the precomputed forward twiddle factor of each recursion level
 template<typename F, int L>
-inline void pow3_FFT_helper(size_t N, Complex<F,L>* x, Complex<F,L>* y, size_t s_in, size_t s_out, direction dir, Complex<F,L>& plus120, Complex<F,L>& minus120) {
+inline void pow3_FFT_helper(size_t N, Complex<F,L>* x, Complex<F,L>* y, size_t s_in, size_t s_out, direction dir, Complex<F,L>& plus120, Complex<F,L>& minus120, Complex<F,L> const *twiddles) {
 
     // Calculate the DFT manually if necessary
     if(N == 3) {
@@ -393,12 +415,13 @@ inline void pow3_FFT_helper(size_t N, Complex<F,L>* x, Complex<F,L>* y, size_t s
     size_t Nprime = N/3;
 
     // Divide into sub-problems
-    pow3_FFT_helper(Nprime, x, y, s_in*3, s_out, dir, plus120, minus120);
-    pow3_FFT_helper(Nprime, x+s_in, y+Nprime*s_out, s_in*3, s_out, dir, plus120, minus120);
-    pow3_FFT_helper(Nprime, x+2*s_in, y+2*Nprime*s_out, s_in*3, s_out, dir, plus120, minus120);
+    pow3_FFT_helper(Nprime, x, y, s_in*3, s_out, dir, plus120, minus120, twiddles + 1);
+    pow3_FFT_helper(Nprime, x+s_in, y+Nprime*s_out, s_in*3, s_out, dir, plus120, minus120, twiddles + 1);
+    pow3_FFT_helper(Nprime, x+2*s_in, y+2*Nprime*s_out, s_in*3, s_out, dir, plus120, minus120, twiddles + 1);
 
     // Combine the sub-problem solutions
-    Complex<F,L> w1 = omega<F,L>::get(1, N, dir);
+    Complex<F,L> w1 = twiddles[0];
+    if(dir == direction::backward) w1 = w1.conjugate();
     Complex<F,L> w2 = w1*w1;
     Complex<F,L> wk1 = w1;
     Complex<F,L> wk2 = w2;
@@ -443,8 +466,104 @@ inline void pow3_FFT(Complex<F,L>* x, Complex<F,L>* y, size_t s_in, size_t s_out
     Complex<F,L> plus120 (-0.5, -sqrt(3)/2.);
     Complex<F,L> minus120 (-0.5, sqrt(3)/2.);
     switch(dir) {
-        case direction::forward:  pow3_FFT_helper(N, x, y, s_in, s_out, dir, plus120, minus120); break;
-        case direction::backward: pow3_FFT_helper(N, x, y, s_in, s_out, dir, minus120, plus120); break;
+        case direction::forward:  pow3_FFT_helper(N, x, y, s_in, s_out, dir, plus120, minus120, sRoot->workspace.data()); break;
+        case direction::backward: pow3_FFT_helper(N, x, y, s_in, s_out, dir, minus120, plus120, sRoot->workspace.data()); break;
+    }
+}
+
+// Internal recursive helper-function that calculates the FFT of a signal with length 5^k,
+// twiddles holds the precomputed forward twiddle factor of each recursion level
+template<typename F, int L>
+inline void pow5_FFT_helper(size_t N, Complex<F,L>* x, Complex<F,L>* y, size_t s_in, size_t s_out, direction dir,
+                            Complex<F,L>& w51, Complex<F,L>& w52, Complex<F,L>& w53, Complex<F,L>& w54, Complex<F,L> const *twiddles) {
+
+    // Calculate the DFT manually if necessary
+    if(N == 5) {
+        y[0]       = x[0] +       x[s_in] +       x[2*s_in] +       x[3*s_in] +       x[4*s_in];
+        y[s_out]   = x[0] + w51 * x[s_in] + w52 * x[2*s_in] + w53 * x[3*s_in] + w54 * x[4*s_in];
+        y[2*s_out] = x[0] + w52 * x[s_in] + w54 * x[2*s_in] + w51 * x[3*s_in] + w53 * x[4*s_in];
+        y[3*s_out] = x[0] + w53 * x[s_in] + w51 * x[2*s_in] + w54 * x[3*s_in] + w52 * x[4*s_in];
+        y[4*s_out] = x[0] + w54 * x[s_in] + w53 * x[2*s_in] + w52 * x[3*s_in] + w51 * x[4*s_in];
+        return;
+    }
+
+    // Calculate the size of the sub-problem
+    size_t Nprime = N/5;
+
+    // Divide into sub-problems
+    pow5_FFT_helper(Nprime, x, y, s_in*5, s_out, dir, w51, w52, w53, w54, twiddles + 1);
+    pow5_FFT_helper(Nprime, x+s_in, y+Nprime*s_out, s_in*5, s_out, dir, w51, w52, w53, w54, twiddles + 1);
+    pow5_FFT_helper(Nprime, x+2*s_in, y+2*Nprime*s_out, s_in*5, s_out, dir, w51, w52, w53, w54, twiddles + 1);
+    pow5_FFT_helper(Nprime, x+3*s_in, y+3*Nprime*s_out, s_in*5, s_out, dir, w51, w52, w53, w54, twiddles + 1);
+    pow5_FFT_helper(Nprime, x+4*s_in, y+4*Nprime*s_out, s_in*5, s_out, dir, w51, w52, w53, w54, twiddles + 1);
+
+    // Combine the sub-problem solutions
+    Complex<F,L> w1 = twiddles[0];
+    if(dir == direction::backward) w1 = w1.conjugate();
+    Complex<F,L> w2 = w1*w1;
+    Complex<F,L> w3 = w2*w1;
+    Complex<F,L> w4 = w2*w2;
+    Complex<F,L> wk1 = w1;
+    Complex<F,L> wk2 = w2;
+    Complex<F,L> wk3 = w3;
+    Complex<F,L> wk4 = w4;
+
+    int k1 =                0;
+    int k2 =   Nprime * s_out;
+    int k3 = 2*Nprime * s_out;
+    int k4 = 3*Nprime * s_out;
+    int k5 = 4*Nprime * s_out;
+
+    Complex<F,L> tmpk     = y[k1];
+    Complex<F,L> tmpk_p_1 = y[k2];
+    Complex<F,L> tmpk_p_2 = y[k3];
+    Complex<F,L> tmpk_p_3 = y[k4];
+    Complex<F,L> tmpk_p_4 = y[k5];
+
+    y[k1] =           tmpk_p_4 +           tmpk_p_3 +           tmpk_p_2 +           tmpk_p_1 + tmpk;
+    y[k2] = w54.fmadd(tmpk_p_4, w53.fmadd(tmpk_p_3, w52.fmadd(tmpk_p_2, w51.fmadd(tmpk_p_1, tmpk))));
+    y[k3] = w53.fmadd(tmpk_p_4, w51.fmadd(tmpk_p_3, w54.fmadd(tmpk_p_2, w52.fmadd(tmpk_p_1, tmpk))));
+    y[k4] = w52.fmadd(tmpk_p_4, w54.fmadd(tmpk_p_3, w51.fmadd(tmpk_p_2, w53.fmadd(tmpk_p_1, tmpk))));
+    y[k5] = w51.fmadd(tmpk_p_4, w52.fmadd(tmpk_p_3, w53.fmadd(tmpk_p_2, w54.fmadd(tmpk_p_1, tmpk))));
+
+    for(size_t k = 1; k < Nprime; k++) {
+        // Index calculation
+        k1 = k * s_out;
+        k2 = (  Nprime + k) * s_out;
+        k3 = (2*Nprime + k) * s_out;
+        k4 = (3*Nprime + k) * s_out;
+        k5 = (4*Nprime + k) * s_out;
+
+        // Storing temporary variables
+        tmpk     = y[k1];
+        tmpk_p_1 = y[k2];
+        tmpk_p_2 = y[k3];
+        tmpk_p_3 = y[k4];
+        tmpk_p_4 = y[k5];
+
+        // Reassigning the output
+        y[k1] = wk4.fmadd(      tmpk_p_4, wk3.fmadd(      tmpk_p_3, wk2.fmadd(      tmpk_p_2, wk1.fmadd(      tmpk_p_1, tmpk))));
+        y[k2] = wk4.fmadd(w54 * tmpk_p_4, wk3.fmadd(w53 * tmpk_p_3, wk2.fmadd(w52 * tmpk_p_2, wk1.fmadd(w51 * tmpk_p_1, tmpk))));
+        y[k3] = wk4.fmadd(w53 * tmpk_p_4, wk3.fmadd(w51 * tmpk_p_3, wk2.fmadd(w54 * tmpk_p_2, wk1.fmadd(w52 * tmpk_p_1, tmpk))));
+        y[k4] = wk4.fmadd(w52 * tmpk_p_4, wk3.fmadd(w54 * tmpk_p_3, wk2.fmadd(w51 * tmpk_p_2, wk1.fmadd(w53 * tmpk_p_1, tmpk))));
+        y[k5] = wk4.fmadd(w51 * tmpk_p_4, wk3.fmadd(w52 * tmpk_p_3, wk2.fmadd(w53 * tmpk_p_2, wk1.fmadd(w54 * tmpk_p_1, tmpk))));
+
+        // Twiddle factors
+        wk1 *= w1; wk2 *= w2; wk3 *= w3; wk4 *= w4;
+    }
+}
+
+// External-facing function for performing an FFT on signal with length N = 5^k
+template<typename F, int L>
+inline void pow5_FFT(Complex<F,L>* x, Complex<F,L>* y, size_t s_in, size_t s_out, biFuncNode<F,L>* sRoot, direction dir) {
+    const size_t N = sRoot->sz;
+    Complex<F,L> w51 (cos(2.*M_PI/5.), -sin(2.*M_PI/5.));
+    Complex<F,L> w52 (cos(4.*M_PI/5.), -sin(4.*M_PI/5.));
+    Complex<F,L> w53 (cos(4.*M_PI/5.),  sin(4.*M_PI/5.));
+    Complex<F,L> w54 (cos(2.*M_PI/5.),  sin(2.*M_PI/5.));
+    switch(dir) {
+        case direction::forward:  pow5_FFT_helper(N, x, y, s_in, s_out, dir, w51, w52, w53, w54, sRoot->workspace.data()); break;
+        case direction::backward: pow5_FFT_helper(N, x, y, s_in, s_out, dir, w54, w53, w52, w51, sRoot->workspace.data()); break;
     }
 }
 
@@ -131,7 +131,8 @@ inline size_t numNodesFactorHelper(const size_t N) {
     // Check if power
     if(power_of(N, 4) ||
         power_of(N, 2) ||
-        power_of(N, 3)) {
+        power_of(N, 3) ||
+        power_of(N, 5)) {
         return N;
     }
     // Check if divisible by a power
@@ -150,6 +151,11 @@ inline size_t numNodesFactorHelper(const size_t N) {
         while ((k % 3) == 0) k /= 3;
         return N / k;
     }
+    if((N % 5) == 0) {
+        size_t k = N;
+        while ((k % 5) == 0) k /= 5;
+        return N / k;
+    }
     // Take a factor
     size_t k = factor(N);
     return (k == N && k > HEFFTE_STOCK_RADER_MIN) ? N-1 : k;
@@ -175,6 +181,9 @@ inline std::pair<fft_type, size_t> fptrFactorHelper(const size_t N) {
     if(power_of(N, 3)) {
         return std::pair<fft_type,size_t> {fft_type::pow3, N};
     }
+    if(power_of(N, 5)) {
+        return std::pair<fft_type,size_t> {fft_type::pow5, N};
+    }
     // Check if N is divisible by a power
     if((N % 4) == 0) {
         size_t ell = N;
@@ -191,6 +200,11 @@ inline std::pair<fft_type, size_t> fptrFactorHelper(const size_t N) {
         while ((ell % 3) == 0) ell /= 3;
         return std::pair<fft_type,size_t> {fft_type::composite, N/ell};
     }
+    if((N % 5) == 0) {
+        size_t ell = N;
+        while ((ell % 5) == 0) ell /= 5;
+        return std::pair<fft_type,size_t> {fft_type::composite, N/ell};
+    }
     // Factor N
     size_t k = factor(N);
     if(k == N) {
@@ -217,10 +231,19 @@ inline size_t init_fft_tree(biFuncNode<F,L>* sRoot, const size_t N) {
     else {
         *sRoot = biFuncNode<F,L>(N, type);
     }
-    if(type == fft_type::discrete ||
-        type == fft_type::pow2     ||
+    if(type == fft_type::pow2     ||
         type == fft_type::pow3     ||
-        type == fft_type::pow4) {
+        type == fft_type::pow4     ||
+        type == fft_type::pow5) {
+        // Precompute the per-level twiddle factors in the otherwise unused workspace,
+        // so the radix kernels avoid regenerating them on every transform
+        size_t radix = (type == fft_type::pow2) ? 2 :
+                       ((type == fft_type::pow3) ? 3 :
+                       ((type == fft_type::pow4) ? 4 : 5));
+        fill_level_twiddles(N, radix, sRoot->workspace.data());
+        return 1;
+    }
+    if(type == fft_type::discrete) {
         return 1;
     }
     size_t q = getLeftover(N, k);
@@ -226,18 +226,26 @@ inline typename pack<float, 8>::type mm_pair_set<float, 8>(float x, float y) { r
 template<>
 inline typename pack<float, 8>::type mm_set1<float,8> (float x) { return _mm256_set1_ps(x); }
 
+//! \brief Creates a vectorized type from pointer to four 32-bit floating point complex numbers
+template<>
+inline typename pack<float, 8>::type mm_complex_load<float,8>(std::complex<float> const *src) {
+    return _mm256_loadu_ps(reinterpret_cast<float const*>(src));
+}
 //! \brief Creates a vectorized type from strided pointer to four 32-bit floating point complex numbers
 template<>
 inline typename pack<float, 8>::type mm_complex_load<float, 8>(std::complex<float> const *src, int stride) {
+    #ifdef __AVX2__
+    // each complex number occupies one 64-bit lane, gather four lanes that sit stride apart
+    if (stride == 1) return mm_complex_load<float,8>(src);
+    return _mm256_castsi256_ps(
+            _mm256_i32gather_epi64(reinterpret_cast<long long const*>(src),
+                                   _mm_setr_epi32(0, stride, 2*stride, 3*stride), 8));
+    #else
     return _mm256_setr_ps(src[0*stride].real(), src[0*stride].imag(),
                           src[1*stride].real(), src[1*stride].imag(),
                           src[2*stride].real(), src[2*stride].imag(),
                           src[3*stride].real(), src[3*stride].imag());
-}
-//! \brief Creates a vectorized type from pointer to four 32-bit floating point complex numbers
-template<>
-inline typename pack<float, 8>::type mm_complex_load<float,8>(std::complex<float> const *src) {
-    return mm_complex_load<float,8>(src, 1);
+    #endif
 }
 
 ///////////////////////////////////////////
@@ -298,15 +306,22 @@ inline typename pack<double, 4>::type mm_pair_set<double, 4>(double x, double y)
 template<>
 inline typename pack<double, 4>::type mm_set1<double, 4>(double x) { return _mm256_set1_pd(x); }
 
+//! \brief Creates a vectorized type from pointer to at least two double-precision complex numbers
+template<>
+inline typename pack<double,4>::type mm_complex_load<double,4>(std::complex<double> const *src) {
+    return _mm256_loadu_pd(reinterpret_cast<double const*>(src));
+}
 //! \brief Creates a vectorized type from strided pointer to at least two double-precision complex numbers
 template<>
 inline typename pack<double,4>::type mm_complex_load<double,4>(std::complex<double> const *src, int stride) {
+    #ifdef __AVX2__
+    // gather the real and imaginary parts of the two complex numbers that sit stride apart
+    if (stride == 1) return mm_complex_load<double,4>(src);
+    return _mm256_i32gather_pd(reinterpret_cast<double const*>(src),
+                               _mm_setr_epi32(0, 1, 2*stride, 2*stride + 1), 8);
+    #else
     return _mm256_setr_pd(src[0].real(), src[0].imag(), src[stride].real(), src[stride].imag());
-}
-//! \brief Creates a vectorized type from pointer to at least two double-precision complex numbers
-template<>
-inline typename pack<double,4>::type mm_complex_load<double,4>(std::complex<double> const *src) {
-    return mm_complex_load<double,4>(src, 1);
+    #endif
 }
 
 ///////////////////////////////////////////////////
@@ -711,19 +726,21 @@ inline typename pack<float, 16>::type mm_pair_set<float, 16>(float x, float y) {
 template<>
 inline typename pack<float, 16>::type mm_set1<float, 16> (float x) { return _mm512_set1_ps(x); }
 
-//! \brief Creates a vectorized type from strided pointer to eight 32-bit floating point complex numbers
+//! \brief Creates a vectorized type from pointer to eight 32-bit floating point complex numbers
 template<>
-inline typename pack<float, 16>::type mm_complex_load<float, 16>(std::complex<float> const *src, int stride) {
-    return _mm512_setr_ps(src[0*stride].real(), src[0*stride].imag(), src[1*stride].real(), src[1*stride].imag(),
-                          src[2*stride].real(), src[2*stride].imag(), src[3*stride].real(), src[3*stride].imag(),
-                          src[4*stride].real(), src[4*stride].imag(), src[5*stride].real(), src[5*stride].imag(),
-                          src[6*stride].real(), src[6*stride].imag(), src[7*stride].real(), src[7*stride].imag());
+inline typename pack<float, 16>::type mm_complex_load<float, 16>(std::complex<float> const *src) {
+    return _mm512_loadu_ps(reinterpret_cast<float const*>(src));
 }
 
-//! \brief Creates a vectorized type from pointer to eight 32-bit floating point complex numbers
+//! \brief Creates a vectorized type from strided pointer to eight 32-bit floating point complex numbers
 template<>
-inline typename pack<float, 16>::type mm_complex_load<float, 16>(std::complex<float> const *src) {
-    return mm_complex_load<float, 16>(src, 1);
+inline typename pack<float, 16>::type mm_complex_load<float, 16>(std::complex<float> const *src, int stride) {
+    // each complex number occupies one 64-bit lane, gather eight lanes that sit stride apart
+    if (stride == 1) return mm_complex_load<float, 16>(src);
+    return _mm512_castsi512_ps(
+            _mm512_i32gather_epi64(_mm256_setr_epi32(0, stride, 2*stride, 3*stride,
+                                                     4*stride, 5*stride, 6*stride, 7*stride),
+                                   reinterpret_cast<void const*>(src), 8));
 }
 
 ///////////////////////////////////////////
@@ -750,16 +767,19 @@ inline typename pack<double, 8>::type mm_pair_set<double, 8>(double x, double y)
 template<>
 inline typename pack<double, 8>::type mm_set1<double, 8>(double x) { return _mm512_set1_pd(x); }
 
-//! \brief Creates a vectorized type from strided pointer to at least four double-precision complex numbers
-template<>
-inline typename pack<double, 8>::type mm_complex_load<double, 8>(std::complex<double> const *src, int stride) {
-    return _mm512_setr_pd(src[0*stride].real(), src[0*stride].imag(), src[1*stride].real(), src[1*stride].imag(),
-                          src[2*stride].real(), src[2*stride].imag(), src[3*stride].real(), src[3*stride].imag());
-}
 //! \brief Creates a vectorized type from pointer to at least four double-precision complex numbers
 template<>
 inline typename pack<double, 8>::type mm_complex_load<double, 8>(std::complex<double> const *src) {
-    return mm_complex_load<double, 8>(src, 1);
+    return _mm512_loadu_pd(reinterpret_cast<double const*>(src));
+}
+//! \brief Creates a vectorized type from strided pointer to at least four double-precision complex numbers
+template<>
+inline typename pack<double, 8>::type mm_complex_load<double, 8>(std::complex<double> const *src, int stride) {
+    // gather the real and imaginary parts of the four complex numbers that sit stride apart
+    if (stride == 1) return mm_complex_load<double, 8>(src);
+    return _mm512_i32gather_pd(_mm256_setr_epi32(0, 1, 2*stride, 2*stride + 1,
+                                                 4*stride, 4*stride + 1, 6*stride, 6*stride + 1),
+                               reinterpret_cast<void const*>(src), 8);
 }
 
 ///////////////////////////////////////////////////
@@ -55,6 +55,29 @@ __global__ void real_complex_convert(index num_entries, scalar_type const source
     }
 }
 
+/*
+ * Launch with one thread per entry, converts from half to single precision.
+ */
+template<int num_threads, typename index>
+__global__ void half_single_convert(index num_entries, __half const source[], float destination[]){
+    index i = blockIdx.x * num_threads + threadIdx.x;
+    while(i < num_entries){
+        destination[i] = __half2float(source[i]);
+        i += num_threads * gridDim.x;
+    }
+}
+/*
+ * Launch with one thread per entry, converts from single to half precision.
+ */
+template<int num_threads, typename index>
+__global__ void single_half_convert(index num_entries, float const source[], __half destination[]){
+    index i = blockIdx.x * num_threads + threadIdx.x;
+    while(i < num_entries){
+        destination[i] = __float2half(source[i]);
+        i += num_threads * gridDim.x;
+    }
+}
+
 /*
  * Launch this with one block per line.
  */
@@ -369,6 +392,22 @@ heffte_instantiate_convert(double, int)
 heffte_instantiate_convert(float, long long)
 heffte_instantiate_convert(double, long long)
 
+template<typename index>
+void convert(cudaStream_t stream, index num_entries, __half const source[], float destination[]){
+    thread_grid_1d grid(num_entries, max_threads);
+    half_single_convert<max_threads><<<grid.blocks, grid.threads, 0, stream>>>(num_entries, source, destination);
+}
+template<typename index>
+void convert(cudaStream_t stream, index num_entries, float const source[], __half destination[]){
+    thread_grid_1d grid(num_entries, max_threads);
+    single_half_convert<max_threads><<<grid.blocks, grid.threads, 0, stream>>>(num_entries, source, destination);
+}
+
+template void convert<int>(cudaStream_t, int num_entries, __half const source[], float destination[]);
+template void convert<int>(cudaStream_t, int num_entries, float const source[], __half destination[]);
+template void convert<long long>(cudaStream_t, long long num_entries, __half const source[], float destination[]);
+template void convert<long long>(cudaStream_t, long long num_entries, float const source[], __half destination[]);
+
 /*
  * For float and double, defines type = <float/double> and tuple_size = 1
  * For complex float/double, defines type <float/double> and typle_size = 2
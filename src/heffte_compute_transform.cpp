@@ -19,7 +19,7 @@ void compute_transform(typename backend::data_manipulator<location_tag>::stream_
                        size_t executor_buffer_offset, size_t size_comm_buffers,
                        std::array<std::unique_ptr<reshape3d_base<index>>, 4> const &shaper,
                        std::array<executor_base*, 3> const &executor,
-                       direction dir){
+                       direction dir, double scale_factor){
 
     /*
      * The logic is a bit messy, but the objective is:
@@ -27,22 +27,45 @@ void compute_transform(typename backend::data_manipulator<location_tag>::stream_
      * - assume that any or all of the shapers can be missing, i.e., null unique_ptr()
      * - do not allocate buffers if not needed
      * - never have more than 2 allocated buffers (input and output)
+     * - fuse the scaling factor into one executor stage, the scaling commutes with
+     *   the reshape operations so the stage can work on any intermediate buffer,
+     *   but the choice of stage must be consistent across the mpi ranks since
+     *   entries migrate between the ranks in-between the stages
      */
 
     scalar_type *executor_workspace = (executor_buffer_offset == 0) ? nullptr : workspace + batch_size * executor_buffer_offset;
 
+    int const scaled_exec = get_scaled_stage(executor, shaper);
+
+    // a reshape with deferred sends leaves messages in flight that read from the workspace,
+    // the sends overlap with the fft stage that follows the reshape but they must complete
+    // before the workspace is reused by another reshape and before this method returns
+    reshape3d_base<index> const *pending_sends = nullptr;
+    auto wait_pending = [&]()->void{
+        if (pending_sends != nullptr){
+            pending_sends->wait_sends();
+            pending_sends = nullptr;
+        }
+    };
+
     auto apply_fft = [&](int i, scalar_type data[])
         ->void{
             add_trace name("fft-1d");
             if (dir == direction::forward){
                 if (executor[i] != nullptr){
                     for(int j=0; j<batch_size; j++)
-                        executor[i]->forward(data + j * executor[i]->box_size(), executor_workspace);
+                        if (i == scaled_exec)
+                            executor[i]->forward(data + j * executor[i]->box_size(), executor_workspace, scale_factor);
+                        else
+                            executor[i]->forward(data + j * executor[i]->box_size(), executor_workspace);
                 }
             }else{
                 if (executor[i] != nullptr){
                     for(int j=0; j<batch_size; j++)
-                        executor[i]->backward(data + j * executor[i]->box_size(), executor_workspace);
+                        if (i == scaled_exec)
+                            executor[i]->backward(data + j * executor[i]->box_size(), executor_workspace, scale_factor);
+                        else
+                            executor[i]->backward(data + j * executor[i]->box_size(), executor_workspace);
                 }
             }
         };
@@ -56,6 +79,7 @@ void compute_transform(typename backend::data_manipulator<location_tag>::stream_
         // use either zeroth shaper or simple copy (or nothing in case of in-place transform)
         if (last == 0){
             shaper[0]->apply(batch_size, input, output, workspace);
+            pending_sends = shaper[0].get();
         }else if (input != output){
             int valid_executor = (executor[0] != nullptr) ? 0 : ((executor[1] != nullptr) ? 1 : 2);
             backend::data_manipulator<location_tag>::copy_n(stream, input, batch_size * executor[valid_executor]->box_size(), output);
@@ -63,6 +87,7 @@ void compute_transform(typename backend::data_manipulator<location_tag>::stream_
         for(int i=0; i<3; i++)
             apply_fft(i, output);
 
+        wait_pending();
         return;
     }
 
@@ -80,10 +105,12 @@ void compute_transform(typename backend::data_manipulator<location_tag>::stream_
             apply_fft(i, effective_input);
         { add_trace name("reshape");
         shaper[last]->apply(batch_size, effective_input, output, workspace);
+        pending_sends = shaper[last].get();
         }
         for(int i=last; i<3; i++)
             apply_fft(i, output);
 
+        wait_pending();
         return;
     }
 
@@ -93,6 +120,7 @@ void compute_transform(typename backend::data_manipulator<location_tag>::stream_
         if (shaper[0]){
             add_trace name("reshape");
             shaper[0]->apply(batch_size, input, temp_buffer, workspace);
+            pending_sends = shaper[0].get();
         }else{
             add_trace name("copy");
             backend::data_manipulator<location_tag>::copy_n(stream, input, batch_size * executor[0]->box_size(), temp_buffer);
@@ -106,6 +134,7 @@ void compute_transform(typename backend::data_manipulator<location_tag>::stream_
         }
         { add_trace name("reshape");
         shaper[active_shaper]->apply(batch_size, output, temp_buffer, workspace);
+        pending_sends = shaper[active_shaper].get();
         }
         active_shaper += 1;
     }
@@ -114,16 +143,22 @@ void compute_transform(typename backend::data_manipulator<location_tag>::stream_
     for(int i=active_shaper; i<last; i++){
         if (shaper[i]){
             add_trace name("reshape");
+            wait_pending();
             shaper[i]->apply(batch_size, temp_buffer, temp_buffer, workspace);
+            pending_sends = shaper[i].get();
         }
         apply_fft(i, temp_buffer);
     }
     { add_trace name("reshape");
+    wait_pending();
     shaper[last]->apply(batch_size, temp_buffer, output, workspace);
+    pending_sends = shaper[last].get();
     }
 
     for(int i=last; i<3; i++)
         apply_fft(i, output);
+
+    wait_pending();
 }
 
 template<typename location_tag, typename index, typename scalar_type>
@@ -133,66 +168,110 @@ void compute_transform(typename backend::data_manipulator<location_tag>::stream_
                        std::complex<scalar_type> workspace[],
                        size_t executor_buffer_offset, size_t size_comm_buffers,
                        std::array<std::unique_ptr<reshape3d_base<index>>, 4> const &shaper,
-                       std::array<executor_base*, 3> const &executor, direction){
+                       std::array<executor_base*, 3> const &executor, direction,
+                       double scale_factor){
     /*
      * Follows logic similar to the complex-to-complex case but the first shaper and executor will be applied to real data.
+     * The scale_factor is fused into the executor stage selected by get_scaled_stage().
      */
     int last = get_last_active(shaper);
+    int const scaled_exec = get_scaled_stage(executor, shaper);
     std::complex<scalar_type> *executor_workspace = (executor_buffer_offset == 0) ?
                                                     nullptr : workspace + batch_size * executor_buffer_offset;
 
+    // see the complex-to-complex variant for the deferred sends logic
+    reshape3d_base<index> const *pending_sends = nullptr;
+    auto wait_pending = [&]()->void{
+        if (pending_sends != nullptr){
+            pending_sends->wait_sends();
+            pending_sends = nullptr;
+        }
+    };
+
     scalar_type* reshaped_input = reinterpret_cast<scalar_type*>(workspace);
     scalar_type const *effective_input = input; // either input or the result of reshape operation 0
     if (shaper[0]){
         add_trace name("reshape");
         shaper[0]->apply(batch_size, input, reshaped_input,
                          reinterpret_cast<scalar_type*>(workspace + batch_size * get_max_box_size(executor)));
+        pending_sends = shaper[0].get();
         effective_input = reshaped_input;
     }
 
     if (last < 1){ // no reshapes after 0
         add_trace name("fft-1d x3");
         for(int j=0; j<batch_size; j++){
-            if (executor[0] != nullptr) executor[0]->forward(effective_input + j * executor[0]->box_size(),
-                                                             output + j * executor[0]->complex_size(), executor_workspace);
-            if (executor[1] != nullptr) executor[1]->forward(output + j * executor[0]->box_size(), executor_workspace);
-            if (executor[2] != nullptr) executor[2]->forward(output + j * executor[0]->box_size(), executor_workspace);
+            if (executor[0] != nullptr){
+                if (scaled_exec == 0)
+                    executor[0]->forward(effective_input + j * executor[0]->box_size(),
+                                         output + j * executor[0]->complex_size(), executor_workspace, scale_factor);
+                else
+                    executor[0]->forward(effective_input + j * executor[0]->box_size(),
+                                         output + j * executor[0]->complex_size(), executor_workspace);
+            }
+            if (executor[1] != nullptr){
+                if (scaled_exec == 1)
+                    executor[1]->forward(output + j * executor[0]->box_size(), executor_workspace, scale_factor);
+                else
+                    executor[1]->forward(output + j * executor[0]->box_size(), executor_workspace);
+            }
+            if (executor[2] != nullptr)
+                executor[2]->forward(output + j * executor[0]->box_size(), executor_workspace, scale_factor);
         }
+        wait_pending();
         return;
     }
 
     // if there is messier combination of transforms, then we need internal buffers
     std::complex<scalar_type> *temp_buffer = workspace + batch_size * size_comm_buffers;
+    // the scratch of the real reshape above may extend into the temp buffer, complete the sends first
+    wait_pending();
     { add_trace name("fft-1d");
         if (executor[0] != nullptr){
             for(int j=0; j<batch_size; j++)
-                executor[0]->forward(effective_input + j * executor[0]->box_size(),
-                                     temp_buffer + j * executor[0]->complex_size(), executor_workspace);
+                if (scaled_exec == 0)
+                    executor[0]->forward(effective_input + j * executor[0]->box_size(),
+                                         temp_buffer + j * executor[0]->complex_size(), executor_workspace, scale_factor);
+                else
+                    executor[0]->forward(effective_input + j * executor[0]->box_size(),
+                                         temp_buffer + j * executor[0]->complex_size(), executor_workspace);
         }
     }
 
     for(int i=1; i<last; i++){
         if (shaper[i]){
             add_trace name("reshape");
+            wait_pending();
             shaper[i]->apply(batch_size, temp_buffer, temp_buffer, workspace);
+            pending_sends = shaper[i].get();
         }
         add_trace name("fft-1d");
         if (executor[i] != nullptr){
             for(int j=0; j<batch_size; j++)
-                executor[i]->forward(temp_buffer + j * executor[i]->box_size(), executor_workspace);
+                if (i == scaled_exec)
+                    executor[i]->forward(temp_buffer + j * executor[i]->box_size(), executor_workspace, scale_factor);
+                else
+                    executor[i]->forward(temp_buffer + j * executor[i]->box_size(), executor_workspace);
         }
     }
     { add_trace name("reshape");
+        wait_pending();
         shaper[last]->apply(batch_size, temp_buffer, output, workspace);
+        pending_sends = shaper[last].get();
     }
 
     for(int i=last; i<3; i++){
         add_trace name("fft-1d");
         if (executor[i] != nullptr){
             for(int j=0; j<batch_size; j++)
-                executor[i]->forward(output + j * executor[i]->box_size(), executor_workspace);
+                if (i == scaled_exec)
+                    executor[i]->forward(output + j * executor[i]->box_size(), executor_workspace, scale_factor);
+                else
+                    executor[i]->forward(output + j * executor[i]->box_size(), executor_workspace);
         }
     }
+
+    wait_pending();
 }
 template<typename location_tag, typename index, typename scalar_type>
 void compute_transform(typename backend::data_manipulator<location_tag>::stream_type stream,
@@ -201,34 +280,53 @@ void compute_transform(typename backend::data_manipulator<location_tag>::stream_
                        std::complex<scalar_type> workspace[],
                        size_t executor_buffer_offset, size_t size_comm_buffers,
                        std::array<std::unique_ptr<reshape3d_base<index>>, 4> const &shaper,
-                       std::array<executor_base*, 3> const &executor, direction){
+                       std::array<executor_base*, 3> const &executor, direction,
+                       double scale_factor){
     /*
      * Follows logic similar to the complex-to-complex case but the last shaper and executor will be applied to real data.
+     * The scale_factor is fused into the executor stage selected by get_scaled_stage().
      */
+    int const scaled_exec = get_scaled_stage(executor, shaper);
     std::complex<scalar_type> *temp_buffer = workspace + batch_size * size_comm_buffers;
     std::complex<scalar_type> *executor_workspace = (executor_buffer_offset == 0) ?
                                                      nullptr : workspace + batch_size * executor_buffer_offset;
 
+    // see the complex-to-complex variant for the deferred sends logic
+    reshape3d_base<index> const *pending_sends = nullptr;
+    auto wait_pending = [&]()->void{
+        if (pending_sends != nullptr){
+            pending_sends->wait_sends();
+            pending_sends = nullptr;
+        }
+    };
+
     if (shaper[0]){
         add_trace name("reshape");
         shaper[0]->apply(batch_size, input, temp_buffer, workspace);
+        pending_sends = shaper[0].get();
     }else{
         add_trace name("copy");
         int valid_executor = (executor[0] != nullptr) ? 0 : ((executor[1] != nullptr) ? 1 : 2);
+        // the input holds complex coefficients, use complex_size() which equals box_size() for the c2c executors
         backend::data_manipulator<location_tag>::copy_n(stream, input,
-                                                        batch_size * executor[valid_executor]->box_size(), temp_buffer);
+                                                        batch_size * executor[valid_executor]->complex_size(), temp_buffer);
     }
 
     for(int i=0; i<2; i++){ // apply the two complex-to-complex ffts
         { add_trace name("fft-1d x3");
             if (executor[i] != nullptr){
                 for(int j=0; j<batch_size; j++)
-                    executor[i]->backward(temp_buffer + j * executor[i]->box_size(), executor_workspace);
+                    if (i == scaled_exec)
+                        executor[i]->backward(temp_buffer + j * executor[i]->box_size(), executor_workspace, scale_factor);
+                    else
+                        executor[i]->backward(temp_buffer + j * executor[i]->box_size(), executor_workspace);
             }
         }
         if (shaper[i+1]){
             add_trace name("reshape");
+            wait_pending();
             shaper[i+1]->apply(batch_size, temp_buffer, temp_buffer, workspace);
+            pending_sends = shaper[i+1].get();
         }
     }
 
@@ -236,25 +334,30 @@ void compute_transform(typename backend::data_manipulator<location_tag>::stream_
     // executor 2 must apply complex to real backward transform
     if (shaper[3]){
         // there is one more reshape left, transform into a real temporary buffer
+        // the real buffer overlaps the communication workspace, complete any deferred sends first
+        wait_pending();
         scalar_type* real_buffer = reinterpret_cast<scalar_type*>(workspace);
         { add_trace name("fft-1d");
             if (executor[2] != nullptr){
                 for(int j=0; j<batch_size; j++)
                     executor[2]->backward(temp_buffer + j * executor[2]->complex_size(),
-                                          real_buffer + j * executor[2]->box_size(), executor_workspace);
+                                          real_buffer + j * executor[2]->box_size(), executor_workspace, scale_factor);
             }
         }
         add_trace name("reshape");
         shaper[3]->apply(batch_size, real_buffer, output, reinterpret_cast<scalar_type*>(workspace +
                          batch_size * ((executor[2] == nullptr) ? 0 : executor[2]->box_size()) ));
+        pending_sends = shaper[3].get();
     }else{
         add_trace name("fft-1d");
         if (executor[2] != nullptr){
             for(int j=0; j<batch_size; j++)
                 executor[2]->backward(temp_buffer + j * executor[2]->complex_size(),
-                                      output + j * executor[2]->box_size(), executor_workspace);
+                                      output + j * executor[2]->box_size(), executor_workspace, scale_factor);
         }
     }
+
+    wait_pending();
 }
 
 #define heffte_instantiate_transform(location_tag, index) \
@@ -264,52 +367,52 @@ void compute_transform(typename backend::data_manipulator<location_tag>::stream_
                         size_t executor_buffer_offset, size_t size_comm_buffers, \
                         std::array<std::unique_ptr<reshape3d_base<index>>, 4> const &shaper, \
                         std::array<executor_base*, 3> const &executor, \
-                        direction dir); \
+                        direction dir, double scale_factor); \
     template void compute_transform<location_tag, index, std::complex<double>>( \
                         typename backend::data_manipulator<location_tag>::stream_type, int const, \
                         std::complex<double> const input[], std::complex<double> output[], std::complex<double> workspace[], \
                         size_t executor_buffer_offset, size_t size_comm_buffers, \
                         std::array<std::unique_ptr<reshape3d_base<index>>, 4> const &shaper, \
                         std::array<executor_base*, 3> const &executor, \
-                        direction dir); \
+                        direction dir, double scale_factor); \
     template void compute_transform<location_tag, index, float>( \
                         typename backend::data_manipulator<location_tag>::stream_type, int const, \
                         float const input[], float output[], float workspace[], \
                         size_t executor_buffer_offset, size_t size_comm_buffers, \
                         std::array<std::unique_ptr<reshape3d_base<index>>, 4> const &shaper, \
                         std::array<executor_base*, 3> const &executor, \
-                        direction dir); \
+                        direction dir, double scale_factor); \
     template void compute_transform<location_tag, index, double>( \
                         typename backend::data_manipulator<location_tag>::stream_type, int const, \
                         double const input[], double output[], double workspace[], \
                         size_t executor_buffer_offset, size_t size_comm_buffers, \
                         std::array<std::unique_ptr<reshape3d_base<index>>, 4> const &shaper, \
                         std::array<executor_base*, 3> const &executor, \
-                        direction dir); \
+                        direction dir, double scale_factor); \
     template void compute_transform<location_tag, index, float>( \
                         typename backend::data_manipulator<location_tag>::stream_type stream, int const, \
                         float const input[], std::complex<float> output[], std::complex<float> workspace[], \
                         size_t executor_buffer_offset, size_t size_comm_buffers, \
                         std::array<std::unique_ptr<reshape3d_base<index>>, 4> const &shaper, \
-                        std::array<executor_base*, 3> const &executor, direction); \
+                        std::array<executor_base*, 3> const &executor, direction, double scale_factor); \
     template void compute_transform<location_tag, index, double>( \
                         typename backend::data_manipulator<location_tag>::stream_type stream, int const, \
                         double const input[], std::complex<double> output[], std::complex<double> workspace[], \
                         size_t executor_buffer_offset, size_t size_comm_buffers, \
                         std::array<std::unique_ptr<reshape3d_base<index>>, 4> const &shaper, \
-                        std::array<executor_base*, 3> const &executor, direction); \
+                        std::array<executor_base*, 3> const &executor, direction, double scale_factor); \
     template void compute_transform<location_tag, index, float>( \
                         typename backend::data_manipulator<location_tag>::stream_type stream, int const, \
                         std::complex<float> const input[], float output[], std::complex<float> workspace[], \
                         size_t executor_buffer_offset, size_t size_comm_buffers, \
                         std::array<std::unique_ptr<reshape3d_base<index>>, 4> const &shaper, \
-                        std::array<executor_base*, 3> const &executor, direction); \
+                        std::array<executor_base*, 3> const &executor, direction, double scale_factor); \
     template void compute_transform<location_tag, index, double>( \
                         typename backend::data_manipulator<location_tag>::stream_type stream, int const, \
                         std::complex<double> const input[], double output[], std::complex<double> workspace[], \
                         size_t executor_buffer_offset, size_t size_comm_buffers, \
                         std::array<std::unique_ptr<reshape3d_base<index>>, 4> const &shaper, \
-                        std::array<executor_base*, 3> const &executor, direction); \
+                        std::array<executor_base*, 3> const &executor, direction, double scale_factor); \
 
 heffte_instantiate_transform(tag::cpu, int)
 heffte_instantiate_transform(tag::cpu, long long)
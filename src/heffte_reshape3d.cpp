@@ -10,6 +10,10 @@
 
 #include "heffte_reshape3d.h"
 
+#if defined(Heffte_ENABLE_CUDA) and defined(OPEN_MPI)
+#include <mpi-ext.h> // for MPIX_CUDA_AWARE_SUPPORT
+#endif
+
 namespace heffte {
 
 #ifdef Heffte_ENABLE_TRACING
@@ -22,15 +26,27 @@ namespace heffte {
     /*!
      * \internal
      * \ingroup hefftereshape
-     * \brief Struct type to convert pre-processor define Heffte_ENABLE_GPU_AWARE_MPI to boolean.
+     * \brief Returns true when MPI calls can be made directly on GPU buffers.
+     *
+     * The compile time capability is controlled by the CMake flag Heffte_ENABLE_GPU_AWARE_MPI.
+     * In addition, when using Open MPI with the CUDA backend, the MPI library is queried at runtime,
+     * since passing device pointers to an MPI build without CUDA support leads to a crash deep
+     * inside the MPI stack. When the runtime support is missing, the reshape operations fall back
+     * to staging the send/recv buffers through the CPU.
      *
      * \endinternal
      */
-#ifdef Heffte_ENABLE_GPU_AWARE_MPI
-    struct disable_gpu_aware : std::false_type {};
-#else
-    struct disable_gpu_aware : std::true_type {};
-#endif
+    inline bool gpu_aware_is_available(){
+        #ifdef Heffte_ENABLE_GPU_AWARE_MPI
+        #if defined(Heffte_ENABLE_CUDA) and defined(MPIX_CUDA_AWARE_SUPPORT)
+        return (MPIX_Query_cuda_support() == 1);
+        #else
+        return true;
+        #endif
+        #else
+        return false;
+        #endif
+    }
 
 
 /*!
@@ -228,7 +244,7 @@ reshape3d_alltoall<location_tag, packer, index>::reshape3d_alltoall(
                    reshape3d_base<index>(cinput_size, coutput_size),
                    backend::device_instance<location_tag>(q),
                    comm(ccomm), me(mpi::comm_rank(comm)), nprocs(mpi::comm_size(comm)),
-                   use_gpu_aware( (disable_gpu_aware::value) ? false : gpu_aware ),
+                   use_gpu_aware( gpu_aware and gpu_aware_is_available() ),
                    packplan(std::move(cpackplan)), unpackplan(std::move(cunpackplan)),
                    send_offset(std::move(csend_offset)), recv_offset(std::move(crecv_offset)),
                    num_entries(cnum_entries)
@@ -241,7 +257,7 @@ void reshape3d_alltoall<location_tag, packer, index>::apply_base(int batch_size,
     scalar_type *send_buffer = workspace;
     scalar_type *recv_buffer = workspace + batch_size * num_entries * packplan.size();
 
-    packer<location_tag> packit;
+    packer<location_tag> packit(this->is_final_stage());
 
     int offset = 0;
 
@@ -352,7 +368,7 @@ reshape3d_alltoallv<location_tag, packer, index>::reshape3d_alltoallv(
     reshape3d_base<index>(cinput_size, coutput_size),
     backend::device_instance<location_tag>(q),
     comm(new_comm), me(mpi::comm_rank(comm)), nprocs(mpi::comm_size(comm)),
-    use_gpu_aware( (disable_gpu_aware::value) ? false : gpu_aware ),
+    use_gpu_aware( gpu_aware and gpu_aware_is_available() ),
     send_offset(std::move(csend_offset)), send_size(std::move(csend_size)),
     recv_offset(std::move(crecv_offset)), recv_size(std::move(crecv_size)),
     send_total(std::accumulate(send_size.begin(), send_size.end(), 0)),
@@ -369,7 +385,7 @@ void reshape3d_alltoallv<location_tag, packer, index>::apply_base(int batch_size
     scalar_type *send_buffer = workspace;
     scalar_type *recv_buffer = workspace + batch_size * this->input_size;
 
-    packer<location_tag> packit;
+    packer<location_tag> packit(this->is_final_stage());
 
     int offset = 0;
 
@@ -498,6 +514,177 @@ make_reshape3d_alltoallv(typename backend::device_instance<location_tag>::stream
                                                        ));
 }
 
+template<typename location_tag, template<typename device> class packer, typename index>
+reshape3d_neighbor<location_tag, packer, index>::reshape3d_neighbor(
+                        typename backend::device_instance<location_tag>::stream_type q,
+                        int cinput_size, int coutput_size, bool gpu_aware, MPI_Comm graph_comm,
+                        std::vector<int> &&csend_offset, std::vector<int> &&csend_size, std::vector<int> &&csend_displ,
+                        std::vector<int> &&crecv_offset, std::vector<int> &&crecv_size, std::vector<int> &&crecv_displ,
+                        std::vector<pack_plan_3d<index>> &&cpackplan, std::vector<pack_plan_3d<index>> &&cunpackplan
+                                                                ) :
+    reshape3d_base<index>(cinput_size, coutput_size),
+    backend::device_instance<location_tag>(q),
+    comm(graph_comm), me(mpi::comm_rank(comm)), nprocs(mpi::comm_size(comm)),
+    use_gpu_aware( gpu_aware and gpu_aware_is_available() ),
+    send_offset(std::move(csend_offset)), send_size(std::move(csend_size)), send_displ(std::move(csend_displ)),
+    recv_offset(std::move(crecv_offset)), recv_size(std::move(crecv_size)), recv_displ(std::move(crecv_displ)),
+    send_total(std::accumulate(send_size.begin(), send_size.end(), 0)),
+    recv_total(std::accumulate(recv_size.begin(), recv_size.end(), 0)),
+    packplan(std::move(cpackplan)), unpackplan(std::move(cunpackplan))
+{}
+
+template<typename location_tag, template<typename device> class packer, typename index>
+template<typename scalar_type>
+void reshape3d_neighbor<location_tag, packer, index>::apply_base(int batch_size, scalar_type const source[], scalar_type destination[], scalar_type workspace[]) const{
+
+    scalar_type *send_buffer = workspace;
+    scalar_type *recv_buffer = workspace + batch_size * this->input_size;
+
+    packer<location_tag> packit(this->is_final_stage());
+
+    { add_trace name("packing");
+    for(size_t i=0; i<packplan.size(); i++){
+        for(int j=0; j<batch_size; j++){
+            packit.pack(this->stream(), packplan[i],
+                        source + send_offset[i] + j * this->input_size,
+                        send_buffer + batch_size * send_displ[i] + j * send_size[i]);
+        }
+    }
+    // the synchronize_device() is needed to flush the kernels of the asynchronous packing
+    this->synchronize_device();
+    }
+
+    #ifdef Heffte_ENABLE_GPU
+    if (std::is_same<location_tag, tag::gpu>::value and not use_gpu_aware){
+        scalar_type *temp = this->template cpu_send_buffer<scalar_type>(batch_size * this->input_size);
+        gpu::transfer::unload(this->stream(), send_buffer, batch_size * this->input_size, temp);
+        send_buffer = temp;
+        recv_buffer = this->template cpu_recv_buffer<scalar_type>(batch_size * this->output_size);
+    }
+    #endif
+
+    { add_trace name("neighbor_a2av");
+        if (batch_size == 1){
+            MPI_Neighbor_alltoallv(send_buffer, send_size.data(), send_displ.data(), mpi::type_from<scalar_type>(),
+                                   recv_buffer, recv_size.data(), recv_displ.data(), mpi::type_from<scalar_type>(),
+                                   comm);
+        }else{
+            std::vector<int> batch_send_size = send_size;
+            std::vector<int> batch_send_displ = send_displ;
+            std::vector<int> batch_recv_size = recv_size;
+            std::vector<int> batch_recv_displ = recv_displ;
+            for(size_t i=0; i<batch_send_size.size(); i++){
+                batch_send_size[i] *= batch_size;
+                batch_send_displ[i] *= batch_size;
+            }
+            for(size_t i=0; i<batch_recv_size.size(); i++){
+                batch_recv_size[i] *= batch_size;
+                batch_recv_displ[i] *= batch_size;
+            }
+            MPI_Neighbor_alltoallv(send_buffer, batch_send_size.data(), batch_send_displ.data(), mpi::type_from<scalar_type>(),
+                                   recv_buffer, batch_recv_size.data(), batch_recv_displ.data(), mpi::type_from<scalar_type>(),
+                                   comm);
+        }
+    }
+
+    #ifdef Heffte_ENABLE_GPU
+    if (std::is_same<location_tag, tag::gpu>::value and not use_gpu_aware){
+        scalar_type* temp = workspace + batch_size * this->input_size;
+        gpu::transfer::load(this->stream(), recv_buffer, batch_size * this->output_size, temp);
+        recv_buffer = temp;
+    }
+    #endif
+
+    { add_trace name("unpacking");
+    for(size_t i=0; i<unpackplan.size(); i++){
+        for(int j=0; j<batch_size; j++){
+            packit.unpack(this->stream(), unpackplan[i],
+                          recv_buffer + batch_size * recv_displ[i] + j * recv_size[i],
+                          destination + recv_offset[i] + j * this->output_size);
+        }
+    }
+    }
+}
+
+template<typename location_tag, template<typename device> class packer, typename index>
+std::unique_ptr<reshape3d_neighbor<location_tag, packer, index>>
+make_reshape3d_neighbor(typename backend::device_instance<location_tag>::stream_type q,
+                        std::vector<box3d<index>> const &input_boxes,
+                        std::vector<box3d<index>> const &output_boxes,
+                        bool uses_gpu_aware,
+                        MPI_Comm const comm){
+
+    int const me = mpi::comm_rank(comm);
+    int const nprocs = mpi::comm_size(comm);
+
+    std::vector<pack_plan_3d<index>> packplan, unpackplan; // will be moved into the class
+    std::vector<int> send_offset;
+    std::vector<int> send_size;
+    std::vector<int> send_proc;
+    std::vector<int> recv_offset;
+    std::vector<int> recv_size;
+    std::vector<int> recv_proc;
+
+    box3d<index> outbox = output_boxes[me];
+    box3d<index> inbox  = input_boxes[me];
+
+    // number of ranks that need data from me
+    int nsend = count_collisions(output_boxes, inbox);
+
+    if (nsend > 0) // if others need something from me, prepare the corresponding sizes and plans
+        compute_overlap_map_direct_pack(me, nprocs, input_boxes[me], output_boxes, send_proc, send_offset, send_size, packplan);
+
+    // number of ranks that I need data from
+    int nrecv = count_collisions(input_boxes, outbox);
+
+    if (nrecv > 0){ // if I need something from others, prepare the corresponding sizes and plans
+        // the transpose logic is included in the unpack procedure, direct_packer does not transpose
+        if (std::is_same<packer<location_tag>, direct_packer<location_tag>>::value){
+            compute_overlap_map_direct_pack(me, nprocs, output_boxes[me], input_boxes, recv_proc, recv_offset, recv_size, unpackplan);
+        }else{
+            compute_overlap_map_transpose_pack(me, nprocs, output_boxes[me], input_boxes, recv_proc, recv_offset, recv_size, unpackplan);
+        }
+    }
+
+    std::vector<int> pgroup = a2a_group(send_proc, recv_proc, input_boxes, output_boxes);
+
+    MPI_Comm new_comm = mpi::new_comm_from_group(pgroup, comm);
+
+    if (pgroup.empty())
+        return std::unique_ptr<reshape3d_neighbor<location_tag, packer, index>>();
+
+    // translate the global ranks of the neighbors to ranks within the sub-communicator,
+    // new_comm_from_group() orders the new ranks by their position in the (sorted) pgroup
+    auto subrank = [&](int p)->int{
+        return static_cast<int>(std::distance(pgroup.begin(), std::lower_bound(pgroup.begin(), pgroup.end(), p)));
+    };
+    std::vector<int> sources, destinations;
+    for(auto p : recv_proc) sources.push_back(subrank(p));
+    for(auto p : send_proc) destinations.push_back(subrank(p));
+
+    // the graph comm fixes the order of the messages in the neighborhood collective
+    // to the order of the sources (receives) and destinations (sends) given here
+    MPI_Comm graph_comm;
+    MPI_Dist_graph_create_adjacent(new_comm, static_cast<int>(sources.size()), sources.data(), MPI_UNWEIGHTED,
+                                   static_cast<int>(destinations.size()), destinations.data(), MPI_UNWEIGHTED,
+                                   MPI_INFO_NULL, 0, &graph_comm);
+    mpi::comm_free(new_comm);
+
+    // the send/recv buffers hold the messages back-to-back in neighbor order
+    std::vector<int> send_displ(send_size.size(), 0);
+    for(size_t i=1; i<send_displ.size(); i++) send_displ[i] = send_displ[i-1] + send_size[i-1];
+    std::vector<int> recv_displ(recv_size.size(), 0);
+    for(size_t i=1; i<recv_displ.size(); i++) recv_displ[i] = recv_displ[i-1] + recv_size[i-1];
+
+    return std::unique_ptr<reshape3d_neighbor<location_tag, packer, index>>(new reshape3d_neighbor<location_tag, packer, index>(
+        q, inbox.count(), outbox.count(),
+        uses_gpu_aware, graph_comm,
+        std::move(send_offset), std::move(send_size), std::move(send_displ),
+        std::move(recv_offset), std::move(recv_size), std::move(recv_displ),
+        std::move(packplan), std::move(unpackplan)
+                                                       ));
+}
+
 template<typename location_tag, template<typename device> class packer, typename index>
 reshape3d_pointtopoint<location_tag, packer, index>::reshape3d_pointtopoint(
                         typename backend::device_instance<location_tag>::stream_type q,
@@ -512,9 +699,9 @@ reshape3d_pointtopoint<location_tag, packer, index>::reshape3d_pointtopoint(
     comm(ccomm), me(mpi::comm_rank(comm)), nprocs(mpi::comm_size(comm)),
     self_to_self(not crecv_proc.empty() and (crecv_proc.back() == me)), // check whether we should include "me" in the communication scheme
     algorithm(alg),
-    use_gpu_aware( (disable_gpu_aware::value) ? false : gpu_aware ),
+    use_gpu_aware( gpu_aware and gpu_aware_is_available() ),
     requests(crecv_proc.size() + ((self_to_self) ? -1 : 0)), // remove 1 if using self-to-self
-    isends(csend_proc.size() + ((self_to_self) ? -1 : 0)), // remove 1 if using self-to-self
+    isends(csend_proc.size() + ((self_to_self) ? -1 : 0), MPI_REQUEST_NULL), // remove 1 if using self-to-self
     send_proc(std::move(csend_proc)), send_offset(std::move(csend_offset)), send_size(std::move(csend_size)),
     recv_proc(std::move(crecv_proc)), recv_offset(std::move(crecv_offset)), recv_size(std::move(crecv_size)),
     recv_loc(std::move(crecv_loc)),
@@ -540,7 +727,7 @@ void reshape3d_pointtopoint<location_tag, packer, index>::no_gpuaware_send_recv(
     scalar_type *cpu_send = this->template cpu_send_buffer<scalar_type>(batch_size * max_send_size);
     scalar_type *cpu_recv = this->template cpu_recv_buffer<scalar_type>(batch_size * this->output_size);
 
-    packer<location_tag> packit;
+    packer<location_tag> packit(this->is_final_stage());
 
     // synchronize before starting the receives, because kernels from an other reshape might
     // still be running, using the workspace
@@ -619,7 +806,7 @@ void reshape3d_pointtopoint<location_tag, packer, index>::no_gpuaware_send_recv(
         }
     }
 
-    if (algorithm == reshape_algorithm::p2p_plined)
+    if (algorithm == reshape_algorithm::p2p_plined and not this->uses_deferred_sends())
         MPI_Waitall(isends.size(), isends.data(), MPI_STATUS_IGNORE);
 }
 #endif
@@ -628,6 +815,11 @@ template<typename location_tag, template<typename device> class packer, typename
 template<typename scalar_type>
 void reshape3d_pointtopoint<location_tag, packer, index>::apply_base(int batch_size, scalar_type const source[], scalar_type destination[], scalar_type workspace[]) const{
 
+    // sends deferred by a previous apply() read from the workspace and hold the request slots,
+    // they must complete before the buffers are reused
+    if (this->uses_deferred_sends())
+        wait_sends();
+
     #ifdef Heffte_ENABLE_GPU
     if (std::is_same<location_tag, tag::gpu>::value and not use_gpu_aware){
         no_gpuaware_send_recv(batch_size, source, destination, workspace);
@@ -638,7 +830,7 @@ void reshape3d_pointtopoint<location_tag, packer, index>::apply_base(int batch_s
     scalar_type *send_buffer = workspace;
     scalar_type *recv_buffer = workspace + batch_size * this->input_size;
 
-    packer<location_tag> packit;
+    packer<location_tag> packit(this->is_final_stage());
 
     // synchronize before starting the receives, because otherwise kernels could be still using
     // the workspace
@@ -709,7 +901,7 @@ void reshape3d_pointtopoint<location_tag, packer, index>::apply_base(int batch_s
         }
     }
 
-    if (algorithm == reshape_algorithm::p2p_plined)
+    if (algorithm == reshape_algorithm::p2p_plined and not this->uses_deferred_sends())
         MPI_Waitall(isends.size(), isends.data(), MPI_STATUS_IGNORE);
 }
 
@@ -768,6 +960,285 @@ make_reshape3d_pointtopoint(typename backend::device_instance<location_tag>::str
                                                        ));
 }
 
+template<typename location_tag, template<typename device> class packer, typename index>
+reshape3d_shared<location_tag, packer, index>::reshape3d_shared(
+                        typename backend::device_instance<location_tag>::stream_type q,
+                        int cinput_size, int coutput_size, MPI_Comm ccomm, MPI_Comm cnode_comm, MPI_Win cwindow, char *cwindow_base,
+                        std::vector<int> &&csend_offset, std::vector<int> &&csend_size, std::vector<int> &&csend_proc,
+                        std::vector<int> &&csend_displ, std::vector<int> &&csend_window,
+                        std::vector<int> &&crecv_offset, std::vector<int> &&crecv_size, std::vector<int> &&crecv_proc,
+                        std::vector<int> &&crecv_loc, std::vector<int> &&cpeer_displ, std::vector<char*> &&cpeer_base,
+                        std::vector<pack_plan_3d<index>> &&cpackplan, std::vector<pack_plan_3d<index>> &&cunpackplan
+                                                                ) :
+    reshape3d_base<index>(cinput_size, coutput_size),
+    backend::device_instance<location_tag>(q),
+    comm(ccomm), me(mpi::comm_rank(comm)), nprocs(mpi::comm_size(comm)),
+    self_to_self(not crecv_proc.empty() and (crecv_proc.back() == me)), // check whether we should include "me" in the communication scheme
+    node_comm(cnode_comm), window(cwindow), window_base(cwindow_base),
+    send_proc(std::move(csend_proc)), send_offset(std::move(csend_offset)), send_size(std::move(csend_size)),
+    send_displ(std::move(csend_displ)), send_window(std::move(csend_window)),
+    recv_proc(std::move(crecv_proc)), recv_offset(std::move(crecv_offset)), recv_size(std::move(crecv_size)),
+    recv_loc(std::move(crecv_loc)),
+    peer_displ(std::move(cpeer_displ)), peer_base(std::move(cpeer_base)),
+    send_total(std::accumulate(send_size.begin(), send_size.end(), 0)),
+    recv_total(std::accumulate(recv_size.begin(), recv_size.end(), 0)),
+    packplan(std::move(cpackplan)), unpackplan(std::move(cunpackplan))
+{}
+
+template<typename location_tag, template<typename device> class packer, typename index>
+template<typename scalar_type>
+void reshape3d_shared<location_tag, packer, index>::apply_base(int batch_size, scalar_type const source[], scalar_type destination[], scalar_type workspace[]) const{
+
+    scalar_type *send_buffer = workspace;
+    scalar_type *recv_buffer = workspace + batch_size * this->input_size;
+
+    packer<location_tag> packit(this->is_final_stage());
+
+    int const num_send = static_cast<int>(send_proc.size()) + ((self_to_self) ? -1 : 0);
+    int const num_recv = static_cast<int>(recv_proc.size()) + ((self_to_self) ? -1 : 0);
+
+    // the window segments are sized for a single transform, batched calls use only the MPI path
+    // the decision is consistent across the ranks since the batch size is the same on all ranks
+    bool const use_window = (batch_size == 1);
+
+    int const tag_ready = 1; // the sender has placed a message in its window segment
+    int const tag_ack   = 2; // the receiver is done reading the window segment
+
+    // queue the receive messages, zero-size ready notifications for the window messages
+    // and asynchronous receives for the messages coming through MPI
+    requests.resize(0);
+    for(int i=0; i<num_recv; i++){
+        if (use_window and peer_base[i] != nullptr){
+            heffte::add_trace name("irecv ready from " + std::to_string(recv_proc[i]));
+            requests.push_back(MPI_Request());
+            MPI_Irecv(nullptr, 0, MPI_BYTE, recv_proc[i], tag_ready, comm, &requests.back());
+        }else{
+            heffte::add_trace name("irecv " + std::to_string(batch_size * recv_size[i]) + " from " + std::to_string(recv_proc[i]));
+            requests.push_back(MPI_Request());
+            MPI_Irecv(recv_buffer + batch_size * recv_loc[i], batch_size * recv_size[i], mpi::type_from<scalar_type>(),
+                      recv_proc[i], 0, comm, &requests.back());
+        }
+    }
+
+    // queue the acks that allow this rank to overwrite its window segment on the next call
+    acks.resize(0);
+    if (use_window){
+        for(int i=0; i<num_send; i++){
+            if (send_window[i] == 1){
+                acks.push_back(MPI_Request());
+                MPI_Irecv(nullptr, 0, MPI_BYTE, send_proc[i], tag_ack, comm, &acks.back());
+            }
+        }
+    }
+
+    isends.resize(0);
+    if (use_window and not acks.empty()){
+        { heffte::add_trace name("win packing");
+            for(int i=0; i<num_send; i++){
+                if (send_window[i] == 1){
+                    packit.pack(this->stream(), packplan[i], source + send_offset[i],
+                                reinterpret_cast<scalar_type*>(window_base + send_displ[i] * sizeof(scalar_type)));
+                }
+            }
+            this->synchronize_device();
+        }
+        MPI_Win_sync(window); // make the written data visible to the other ranks on the node
+        for(int i=0; i<num_send; i++){
+            if (send_window[i] == 1){
+                heffte::add_trace name("isend ready for " + std::to_string(send_proc[i]));
+                isends.push_back(MPI_Request());
+                MPI_Isend(nullptr, 0, MPI_BYTE, send_proc[i], tag_ready, comm, &isends.back());
+            }
+        }
+    }
+
+    // perform the off-node (or batched) send commands, using blocking send
+    size_t offset = 0;
+    for(int i=0; i<num_send; i++){
+        if (use_window and send_window[i] == 1) continue;
+        { heffte::add_trace name("packing");
+            for(int j=0; j<batch_size; j++){
+                packit.pack(this->stream(), packplan[i], source + j * this->input_size + send_offset[i],
+                            send_buffer + offset + j * send_size[i]);
+            }
+            this->synchronize_device();
+        }
+
+        { heffte::add_trace name("send " + std::to_string(batch_size * send_size[i]) + " for " + std::to_string(send_proc[i]));
+        MPI_Send(send_buffer + offset, batch_size * send_size[i], mpi::type_from<scalar_type>(),
+                 send_proc[i], 0, comm);
+        }
+        offset += batch_size * send_size[i];
+    }
+
+    if (self_to_self){ // if using self-to-self, do not invoke an MPI command
+        { heffte::add_trace name("self packing");
+            for(int j=0; j<batch_size; j++){
+                packit.pack(this->stream(), packplan.back(), source + send_offset.back() + j * this->input_size,
+                            recv_buffer + batch_size * recv_loc.back() + j * send_size.back());
+            }
+        }
+
+        { heffte::add_trace name("self unpacking");
+            for(int j=0; j<batch_size; j++){
+                packit.unpack(this->stream(), unpackplan.back(), recv_buffer + batch_size * recv_loc.back() + j * send_size.back(),
+                              destination + j * this->output_size + recv_offset.back());
+            }
+        }
+    }
+
+    for(size_t i=0; i<requests.size(); i++){
+        int irecv;
+        { heffte::add_trace name("waitany");
+        MPI_Waitany(requests.size(), requests.data(), &irecv, MPI_STATUS_IGNORE);
+        }
+
+        if (use_window and peer_base[irecv] != nullptr){
+            MPI_Win_sync(window); // make the data written by the sender visible to this rank
+            { heffte::add_trace name("win unpacking from " + std::to_string(recv_proc[irecv]));
+                packit.unpack(this->stream(), unpackplan[irecv],
+                              reinterpret_cast<scalar_type const*>(peer_base[irecv] + peer_displ[irecv] * sizeof(scalar_type)),
+                              destination + recv_offset[irecv]);
+                this->synchronize_device();
+            }
+            isends.push_back(MPI_Request());
+            MPI_Isend(nullptr, 0, MPI_BYTE, recv_proc[irecv], tag_ack, comm, &isends.back());
+        }else{
+            heffte::add_trace name("unpacking from " + std::to_string(recv_proc[irecv]));
+            for(int j=0; j<batch_size; j++){
+                packit.unpack(this->stream(), unpackplan[irecv], recv_buffer + batch_size * recv_loc[irecv] + j * recv_size[irecv],
+                              destination + j * this->output_size + recv_offset[irecv]);
+            }
+        }
+    }
+
+    // wait until the window receivers are done before allowing a new apply to overwrite the segment
+    if (not acks.empty())
+        MPI_Waitall(acks.size(), acks.data(), MPI_STATUS_IGNORE);
+    if (not isends.empty())
+        MPI_Waitall(isends.size(), isends.data(), MPI_STATUS_IGNORE);
+}
+
+template<typename location_tag, template<typename device> class packer, typename index>
+std::unique_ptr<reshape3d_shared<location_tag, packer, index>>
+make_reshape3d_shared(typename backend::device_instance<location_tag>::stream_type stream,
+                      std::vector<box3d<index>> const &input_boxes,
+                      std::vector<box3d<index>> const &output_boxes,
+                      bool, MPI_Comm const comm){
+
+    static_assert(std::is_same<location_tag, tag::cpu>::value,
+                  "reshape3d_shared uses a host memory window and works only with cpu buffers");
+
+    int const me = mpi::comm_rank(comm);
+    int const nprocs = mpi::comm_size(comm);
+
+    std::vector<pack_plan_3d<index>> packplan, unpackplan; // will be moved into the class
+    std::vector<int> send_offset;
+    std::vector<int> send_size;
+    std::vector<int> send_proc;
+    std::vector<int> recv_offset;
+    std::vector<int> recv_size;
+    std::vector<int> recv_proc;
+    std::vector<int> recv_loc;
+
+    box3d<index> outbox = output_boxes[me];
+    box3d<index> inbox  = input_boxes[me];
+
+    // number of ranks that need data from me
+    int nsend = count_collisions(output_boxes, inbox);
+
+    if (nsend > 0) // if others need something from me, prepare the corresponding sizes and plans
+        compute_overlap_map_direct_pack(me, nprocs, input_boxes[me], output_boxes, send_proc, send_offset, send_size, packplan);
+
+    // number of ranks that I need data from
+    int nrecv = count_collisions(input_boxes, outbox);
+
+    if (nrecv > 0){ // if I need something from others, prepare the corresponding sizes and plans
+        // the transpose logic is included in the unpack procedure, direct_packer does not transpose
+        if (std::is_same<packer<location_tag>, direct_packer<location_tag>>::value){
+            compute_overlap_map_direct_pack(me, nprocs, output_boxes[me], input_boxes, recv_proc, recv_offset, recv_size, unpackplan);
+        }else{
+            compute_overlap_map_transpose_pack(me, nprocs, output_boxes[me], input_boxes, recv_proc, recv_offset, recv_size, unpackplan);
+        }
+    }
+
+    recv_loc.push_back(0);
+    if (not recv_size.empty())
+        for(size_t i=0; i<recv_size.size() - 1; i++)
+            recv_loc.push_back(recv_loc.back() + recv_size[i]);
+
+    // the location of each message within this rank's window segment
+    std::vector<int> send_displ(send_size.size(), 0);
+    for(size_t i=1; i<send_displ.size(); i++) send_displ[i] = send_displ[i-1] + send_size[i-1];
+
+    // tell each receiver where its message sits within the sender's window segment
+    std::vector<int> peer_displ(recv_proc.size(), 0);
+    {
+        int const tag_setup = 3;
+        std::vector<MPI_Request> setup;
+        for(size_t i=0; i<send_proc.size(); i++){
+            if (send_proc[i] == me) continue;
+            setup.push_back(MPI_Request());
+            MPI_Isend(&send_displ[i], 1, MPI_INT, send_proc[i], tag_setup, comm, &setup.back());
+        }
+        for(size_t i=0; i<recv_proc.size(); i++){
+            if (recv_proc[i] == me) continue;
+            MPI_Recv(&peer_displ[i], 1, MPI_INT, recv_proc[i], tag_setup, comm, MPI_STATUS_IGNORE);
+        }
+        if (not setup.empty())
+            MPI_Waitall(setup.size(), setup.data(), MPI_STATUS_IGNORE);
+    }
+
+    // split the node-local ranks and allocate the shared window
+    // the segment covers the send messages of a single transform in the largest scalar type
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, me, MPI_INFO_NULL, &node_comm);
+    char *window_base = nullptr;
+    MPI_Win window;
+    MPI_Win_allocate_shared(static_cast<MPI_Aint>(inbox.count()) * sizeof(std::complex<double>), 1,
+                            MPI_INFO_NULL, node_comm, &window_base, &window);
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, window);
+
+    // mark which messages stay on the node, the ranks missing from the node group are off-node
+    MPI_Group world_group, node_group;
+    MPI_Comm_group(comm, &world_group);
+    MPI_Comm_group(node_comm, &node_group);
+
+    std::vector<int> send_window(send_proc.size(), 0);
+    for(size_t i=0; i<send_proc.size(); i++){
+        if (send_proc[i] == me) continue;
+        int node_rank;
+        MPI_Group_translate_ranks(world_group, 1, &send_proc[i], node_group, &node_rank);
+        if (node_rank != MPI_UNDEFINED) send_window[i] = 1;
+    }
+
+    std::vector<char*> peer_base(recv_proc.size(), nullptr);
+    for(size_t i=0; i<recv_proc.size(); i++){
+        if (recv_proc[i] == me) continue;
+        int node_rank;
+        MPI_Group_translate_ranks(world_group, 1, &recv_proc[i], node_group, &node_rank);
+        if (node_rank != MPI_UNDEFINED){
+            MPI_Aint segment_size;
+            int disp_unit;
+            void *base = nullptr;
+            MPI_Win_shared_query(window, node_rank, &segment_size, &disp_unit, &base);
+            peer_base[i] = reinterpret_cast<char*>(base);
+        }
+    }
+
+    MPI_Group_free(&world_group);
+    MPI_Group_free(&node_group);
+
+    return std::unique_ptr<reshape3d_shared<location_tag, packer, index>>(new reshape3d_shared<location_tag, packer, index>(
+        stream, inbox.count(), outbox.count(), comm, node_comm, window, window_base,
+        std::move(send_offset), std::move(send_size), std::move(send_proc),
+        std::move(send_displ), std::move(send_window),
+        std::move(recv_offset), std::move(recv_size), std::move(recv_proc),
+        std::move(recv_loc), std::move(peer_displ), std::move(peer_base),
+        std::move(packplan), std::move(unpackplan)
+                                                       ));
+}
+
 #define heffte_instantiate_reshape3d_algorithm(alg, make_alg, some_backend, index) \
 template void alg<some_backend, direct_packer, index>::apply_base<float>(int, float const[], float[], float[]) const; \
 template void alg<some_backend, direct_packer, index>::apply_base<double>(int, double const[], double[], double[]) const; \
@@ -789,6 +1260,7 @@ make_alg<some_backend, transpose_packer, index>(typename backend::device_instanc
 #define heffte_instantiate_reshape3d(some_backend, index) \
 heffte_instantiate_reshape3d_algorithm(reshape3d_alltoall, make_reshape3d_alltoall, some_backend, index) \
 heffte_instantiate_reshape3d_algorithm(reshape3d_alltoallv, make_reshape3d_alltoallv, some_backend, index) \
+heffte_instantiate_reshape3d_algorithm(reshape3d_neighbor, make_reshape3d_neighbor, some_backend, index) \
  \
 template void reshape3d_pointtopoint<some_backend, direct_packer, index>::apply_base<float>(int, float const[], float[], float[]) const; \
 template void reshape3d_pointtopoint<some_backend, direct_packer, index>::apply_base<double>(int, double const[], double[], double[]) const; \
@@ -811,6 +1283,10 @@ make_reshape3d_pointtopoint<some_backend, transpose_packer, index>(typename back
 heffte_instantiate_reshape3d(tag::cpu, int)
 heffte_instantiate_reshape3d(tag::cpu, long long)
 
+// the shared memory window resides on the host, the reshape is instantiated only for cpu buffers
+heffte_instantiate_reshape3d_algorithm(reshape3d_shared, make_reshape3d_shared, tag::cpu, int)
+heffte_instantiate_reshape3d_algorithm(reshape3d_shared, make_reshape3d_shared, tag::cpu, long long)
+
 #ifdef Heffte_ENABLE_GPU
 heffte_instantiate_reshape3d(tag::gpu, int)
 heffte_instantiate_reshape3d(tag::gpu, long long)
@@ -85,6 +85,8 @@ template<> std::string get_description<reshape_algorithm::alltoallv>(){ return "
 template<> std::string get_description<reshape_algorithm::alltoall>(){ return "heffte::reshape3d_alltoall"; }
 template<> std::string get_description<reshape_algorithm::p2p>(){ return "heffte::reshape3d_pointtopoint"; }
 template<> std::string get_description<reshape_algorithm::p2p_plined>(){ return "heffte::reshape3d_p2p (plined)"; }
+template<> std::string get_description<reshape_algorithm::neighbor_alltoallv>(){ return "heffte::reshape3d_neighbor"; }
+template<> std::string get_description<reshape_algorithm::shared_memory>(){ return "heffte::reshape3d_shared"; }
 
 template<typename scalar_variant = int, typename mpi_tag = using_mpi, typename backend_tag = void>
 struct current_test{
@@ -301,6 +303,10 @@ heffte::plan_options args_to_options(std::deque<std::string> const &args){
             options.algorithm = reshape_algorithm::p2p;
         }else if (s == "-p2p_pl"){
             options.algorithm = reshape_algorithm::p2p_plined;
+        }else if (s == "-na2av"){
+            options.algorithm = reshape_algorithm::neighbor_alltoallv;
+        }else if (s == "-shmem"){
+            options.algorithm = reshape_algorithm::shared_memory;
         }else if (s == "-pencils"){
             options.use_pencils = true;
         }else if (s == "-slabs"){
@@ -227,6 +227,13 @@ void test_fft3d_vectors(MPI_Comm comm){
         auto backward_scaled_cresult = rescale(world, backward_cresult, scale::none);
         tassert(approx(local_complex_input, backward_scaled_cresult));
 
+        auto moved_input = result; // the rvalue overload consumes the input buffer
+        auto backward_inplace = fft.backward(std::move(moved_input), bscale[i]);
+        // the result occupies the leading size_inbox() entries of the returned buffer
+        decltype(backward_inplace) backward_mresult(backward_inplace.data(), backward_inplace.data() + fft.size_inbox());
+        auto backward_scaled_mresult = rescale(world, backward_mresult, scale::none);
+        tassert(approx(local_complex_input, backward_scaled_mresult));
+
         auto backward_rresult = fft.backward_real(result, bscale[i]);
         auto backward_scaled_rresult = rescale(world, backward_rresult, scale::none);
         tassert(approx(backward_scaled_rresult, local_real_input));
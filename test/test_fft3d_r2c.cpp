@@ -20,6 +20,14 @@ void test_fft3d_r2c_const_dest2(MPI_Comm comm){
         // construct an instance of heffte::fft3d and delete it immediately
         heffte::fft3d_r2c<backend_tag> fft(rboxes[me], cboxes[me], dim, comm);
     }
+
+    { // same constructor through the factory with a compile-time direction
+        std::vector<box3d<>> rboxes = heffte::split_world(world, {2, 1, 1});
+        std::vector<box3d<>> cboxes = heffte::split_world(world.r2c(0), {2, 1, 1});
+        auto fft = heffte::make_fft3d_r2c<0, backend_tag>(rboxes[me], cboxes[me], comm);
+        static_assert(std::is_same<decltype(fft), heffte::fft3d_r2c<backend_tag, int>>::value,
+                      "heffte::make_fft3d_r2c failed to auto-detect int");
+    }
 }
 
 template<typename backend_tag, typename scalar_type, int h0, int h1, int h2>
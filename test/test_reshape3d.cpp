@@ -79,6 +79,13 @@ make_test_reshape3d(typename backend::device_instance<location_tag>::stream_type
         return make_reshape3d_pointtopoint<location_tag>(q, input_boxes, output_boxes, reshape_algorithm::p2p, true, comm);
     }else if (variant == reshape_algorithm::p2p_plined){
         return make_reshape3d_pointtopoint<location_tag>(q, input_boxes, output_boxes, reshape_algorithm::p2p_plined, true, comm);
+    }else if (variant == reshape_algorithm::neighbor_alltoallv){
+        return make_reshape3d_neighbor<location_tag>(q, input_boxes, output_boxes, true, comm);
+    }else if (variant == reshape_algorithm::shared_memory){
+        // dispatches to the cpu shared window implementation or the gpu point-to-point fallback
+        heffte::plan_options options = heffte::default_options<backend::stock>();
+        options.algorithm = variant;
+        return make_reshape3d<typename default_tag<location_tag>::backend_tag>(q, input_boxes, output_boxes, comm, options);
     }
 }
 
@@ -434,11 +441,14 @@ void test_alltoone_all(){
     test_alltoone_variants<tag::cpu, reshape_algorithm::alltoallv>();
     test_alltoone_variants<tag::cpu, reshape_algorithm::p2p>();
     test_alltoone_variants<tag::cpu, reshape_algorithm::p2p_plined>();
+    test_alltoone_variants<tag::cpu, reshape_algorithm::neighbor_alltoallv>();
+    test_alltoone_variants<tag::cpu, reshape_algorithm::shared_memory>();
     #ifdef Heffte_ENABLE_GPU
     test_alltoone_variants<tag::gpu, reshape_algorithm::alltoall>();
     test_alltoone_variants<tag::gpu, reshape_algorithm::alltoallv>();
     test_alltoone_variants<tag::gpu, reshape_algorithm::p2p>();
     test_alltoone_variants<tag::gpu, reshape_algorithm::p2p_plined>();
+    test_alltoone_variants<tag::gpu, reshape_algorithm::neighbor_alltoallv>();
     #endif
 }
 
@@ -463,6 +473,14 @@ void perform_tests_cpu(){
             test_cpu<10, 20, 17, 2, 2, 1, double, heffte::tag::cpu, reshape_algorithm::p2p>(comm);
             test_cpu<30, 10, 10, 2, 2, 1, std::complex<float>, heffte::tag::cpu, reshape_algorithm::p2p>(comm);
             test_cpu<11, 10, 13, 2, 2, 1, std::complex<double>, heffte::tag::cpu, reshape_algorithm::p2p>(comm);
+            test_cpu<10, 13, 10, 2, 2, 1, float, heffte::tag::cpu, reshape_algorithm::neighbor_alltoallv>(comm);
+            test_cpu<10, 20, 17, 2, 2, 1, double, heffte::tag::cpu, reshape_algorithm::neighbor_alltoallv>(comm);
+            test_cpu<30, 10, 10, 2, 2, 1, std::complex<float>, heffte::tag::cpu, reshape_algorithm::neighbor_alltoallv>(comm);
+            test_cpu<11, 10, 13, 2, 2, 1, std::complex<double>, heffte::tag::cpu, reshape_algorithm::neighbor_alltoallv>(comm);
+            test_cpu<10, 13, 10, 2, 2, 1, float, heffte::tag::cpu, reshape_algorithm::shared_memory>(comm);
+            test_cpu<10, 20, 17, 2, 2, 1, double, heffte::tag::cpu, reshape_algorithm::shared_memory>(comm);
+            test_cpu<30, 10, 10, 2, 2, 1, std::complex<float>, heffte::tag::cpu, reshape_algorithm::shared_memory>(comm);
+            test_cpu<11, 10, 13, 2, 2, 1, std::complex<double>, heffte::tag::cpu, reshape_algorithm::shared_memory>(comm);
             break;
         case 12:
             test_cpu<13, 13, 10, 3, 4, 1, float, heffte::tag::cpu, reshape_algorithm::alltoall>(comm);
@@ -475,6 +493,14 @@ void perform_tests_cpu(){
             test_cpu<16, 21, 17, 2, 3, 2, double, heffte::tag::cpu, reshape_algorithm::p2p>(comm);
             test_cpu<38, 13, 20, 1, 4, 3, std::complex<float>, heffte::tag::cpu, reshape_algorithm::p2p>(comm);
             test_cpu<41, 17, 15, 3, 2, 2, std::complex<double>, heffte::tag::cpu, reshape_algorithm::p2p>(comm);
+            test_cpu<13, 13, 10, 3, 4, 1, float, heffte::tag::cpu, reshape_algorithm::neighbor_alltoallv>(comm);
+            test_cpu<16, 21, 17, 2, 3, 2, double, heffte::tag::cpu, reshape_algorithm::neighbor_alltoallv>(comm);
+            test_cpu<38, 13, 20, 1, 4, 3, std::complex<float>, heffte::tag::cpu, reshape_algorithm::neighbor_alltoallv>(comm);
+            test_cpu<41, 17, 15, 3, 2, 2, std::complex<double>, heffte::tag::cpu, reshape_algorithm::neighbor_alltoallv>(comm);
+            test_cpu<13, 13, 10, 3, 4, 1, float, heffte::tag::cpu, reshape_algorithm::shared_memory>(comm);
+            test_cpu<16, 21, 17, 2, 3, 2, double, heffte::tag::cpu, reshape_algorithm::shared_memory>(comm);
+            test_cpu<38, 13, 20, 1, 4, 3, std::complex<float>, heffte::tag::cpu, reshape_algorithm::shared_memory>(comm);
+            test_cpu<41, 17, 15, 3, 2, 2, std::complex<double>, heffte::tag::cpu, reshape_algorithm::shared_memory>(comm);
             break;
         default:
             // unknown test
@@ -502,6 +528,10 @@ void perform_tests_gpu(){
             test_gpu<10, 20, 17, 2, 2, 1, double, heffte::tag::gpu, reshape_algorithm::p2p>(comm);
             test_gpu<30, 10, 10, 2, 2, 1, std::complex<float>, heffte::tag::gpu, reshape_algorithm::p2p>(comm);
             test_gpu<11, 10, 13, 2, 2, 1, std::complex<double>, heffte::tag::gpu, reshape_algorithm::p2p>(comm);
+            test_gpu<10, 13, 10, 2, 2, 1, float, heffte::tag::gpu, reshape_algorithm::neighbor_alltoallv>(comm);
+            test_gpu<10, 20, 17, 2, 2, 1, double, heffte::tag::gpu, reshape_algorithm::neighbor_alltoallv>(comm);
+            test_gpu<30, 10, 10, 2, 2, 1, std::complex<float>, heffte::tag::gpu, reshape_algorithm::neighbor_alltoallv>(comm);
+            test_gpu<11, 10, 13, 2, 2, 1, std::complex<double>, heffte::tag::gpu, reshape_algorithm::neighbor_alltoallv>(comm);
             break;
         case 12:
             test_gpu<13, 13, 10, 3, 4, 1, float, heffte::tag::gpu, reshape_algorithm::alltoall>(comm);
@@ -514,6 +544,10 @@ void perform_tests_gpu(){
             test_gpu<16, 21, 17, 2, 3, 2, double, heffte::tag::gpu, reshape_algorithm::p2p>(comm);
             test_gpu<38, 13, 20, 1, 4, 3, std::complex<float>, heffte::tag::gpu, reshape_algorithm::p2p>(comm);
             test_gpu<41, 17, 15, 3, 2, 2, std::complex<double>, heffte::tag::gpu, reshape_algorithm::p2p>(comm);
+            test_gpu<13, 13, 10, 3, 4, 1, float, heffte::tag::gpu, reshape_algorithm::neighbor_alltoallv>(comm);
+            test_gpu<16, 21, 17, 2, 3, 2, double, heffte::tag::gpu, reshape_algorithm::neighbor_alltoallv>(comm);
+            test_gpu<38, 13, 20, 1, 4, 3, std::complex<float>, heffte::tag::gpu, reshape_algorithm::neighbor_alltoallv>(comm);
+            test_gpu<41, 17, 15, 3, 2, 2, std::complex<double>, heffte::tag::gpu, reshape_algorithm::neighbor_alltoallv>(comm);
             break;
         default:
             // unknown test
@@ -536,6 +570,10 @@ void perform_tests_reorder(){
         test_reshape_transposed<std::complex<float>, reshape_algorithm::p2p>(comm);
         test_reshape_transposed<double, reshape_algorithm::p2p_plined>(comm);
         test_reshape_transposed<std::complex<float>, reshape_algorithm::p2p_plined>(comm);
+        test_reshape_transposed<float, reshape_algorithm::neighbor_alltoallv>(comm);
+        test_reshape_transposed<std::complex<double>, reshape_algorithm::neighbor_alltoallv>(comm);
+        test_reshape_transposed<double, reshape_algorithm::shared_memory>(comm);
+        test_reshape_transposed<std::complex<float>, reshape_algorithm::shared_memory>(comm);
     }
 }
 
@@ -180,7 +180,8 @@ template<typename F, int L>
 void test_fft_template(int N,
                        std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> fftForward,
                        std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> fftBackward,
-                       std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> refForward) {
+                       std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> refForward,
+                       double correction = 1.0) {
     complex_vector<F,L> input {};
     constexpr int vec_sz = vec_size(L);
     std::vector<std::complex<F>>   stl_input {};
@@ -218,11 +219,11 @@ void test_fft_template(int N,
     refForward(input, output_forward_ref);
     vec_to_std_complex(stl_output_forward_fft, output_forward_fft);
     vec_to_std_complex(stl_output_forward_ref, output_forward_ref);
-    sassert(approx(stl_output_forward_fft, stl_output_forward_ref));
+    sassert(approx(stl_output_forward_fft, stl_output_forward_ref, correction));
     fftBackward(output_forward_fft, output_backward_fft);
     for(auto &r : output_backward_fft) r /= input.size();
     vec_to_std_complex(stl_output_backward_fft, output_backward_fft);
-    sassert(approx(stl_output_backward_fft, stl_input));
+    sassert(approx(stl_output_backward_fft, stl_input, correction));
 }
 
 // Testing the DFT
@@ -289,11 +290,13 @@ void test_stock_dft() {
 // Test the radix-2 Fourier Transform
 template<typename F, int L>
 void test_stock_pow2_template() {
-    std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> fftForward = [](complex_vector<F,L>& input, complex_vector<F,L>& output) {
-        heffte::stock::pow2_FFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::forward);
+    complex_vector<F,L> twiddles(4);
+    heffte::stock::fill_level_twiddles<F,L>(16, 2, twiddles.data());
+    std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> fftForward = [&twiddles](complex_vector<F,L>& input, complex_vector<F,L>& output) {
+        heffte::stock::pow2_FFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::forward, twiddles.data());
     };
-    std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> fftBackward = [](complex_vector<F,L>& input, complex_vector<F,L>& output) {
-        heffte::stock::pow2_FFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::backward);
+    std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> fftBackward = [&twiddles](complex_vector<F,L>& input, complex_vector<F,L>& output) {
+        heffte::stock::pow2_FFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::backward, twiddles.data());
     };
     std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> refForward = [](complex_vector<F,L>& input, complex_vector<F,L>& output) {
         heffte::stock::DFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::forward);
@@ -323,11 +326,13 @@ template<typename F, int L>
 void test_stock_pow3_template() {
     heffte::stock::Complex<F,L> plus120 (-0.5, -sqrt(3)/2.);
     heffte::stock::Complex<F,L> minus120 (-0.5, sqrt(3)/2.);
-    std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> fftForward = [&plus120, &minus120](complex_vector<F,L>& input, complex_vector<F,L>& output) {
-        heffte::stock::pow3_FFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::forward, plus120, minus120);
+    complex_vector<F,L> twiddles(2);
+    heffte::stock::fill_level_twiddles<F,L>(9, 3, twiddles.data());
+    std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> fftForward = [&plus120, &minus120, &twiddles](complex_vector<F,L>& input, complex_vector<F,L>& output) {
+        heffte::stock::pow3_FFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::forward, plus120, minus120, twiddles.data());
     };
-    std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> fftBackward = [&plus120, &minus120](complex_vector<F,L>& input, complex_vector<F,L>& output) {
-        heffte::stock::pow3_FFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::backward, minus120, plus120);
+    std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> fftBackward = [&plus120, &minus120, &twiddles](complex_vector<F,L>& input, complex_vector<F,L>& output) {
+        heffte::stock::pow3_FFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::backward, minus120, plus120, twiddles.data());
     };
     std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> refForward = [](complex_vector<F,L>& input, complex_vector<F,L>& output) {
         heffte::stock::DFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::forward);
@@ -355,11 +360,13 @@ void test_stock_fft_pow3() {
 // Test the radix-2 Fourier Transform
 template<typename F, int L>
 void test_stock_pow4_template() {
-    std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> fftForward = [](complex_vector<F,L>& input, complex_vector<F,L>& output) {
-        heffte::stock::pow4_FFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::forward);
+    complex_vector<F,L> twiddles(2);
+    heffte::stock::fill_level_twiddles<F,L>(16, 4, twiddles.data());
+    std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> fftForward = [&twiddles](complex_vector<F,L>& input, complex_vector<F,L>& output) {
+        heffte::stock::pow4_FFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::forward, twiddles.data());
     };
-    std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> fftBackward = [](complex_vector<F,L>& input, complex_vector<F,L>& output) {
-        heffte::stock::pow4_FFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::backward);
+    std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> fftBackward = [&twiddles](complex_vector<F,L>& input, complex_vector<F,L>& output) {
+        heffte::stock::pow4_FFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::backward, twiddles.data());
     };
     std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> refForward = [](complex_vector<F,L>& input, complex_vector<F,L>& output) {
         heffte::stock::DFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::forward);
@@ -384,9 +391,48 @@ void test_stock_fft_pow4() {
     test_stock_pow4_typed<double>();
 }
 
+// Represents the radix-5 Fourier Transform
+template<typename F, int L>
+void test_stock_pow5_template() {
+    heffte::stock::Complex<F,L> w51 (cos(2.*M_PI/5.), -sin(2.*M_PI/5.));
+    heffte::stock::Complex<F,L> w52 (cos(4.*M_PI/5.), -sin(4.*M_PI/5.));
+    heffte::stock::Complex<F,L> w53 (cos(4.*M_PI/5.),  sin(4.*M_PI/5.));
+    heffte::stock::Complex<F,L> w54 (cos(2.*M_PI/5.),  sin(2.*M_PI/5.));
+    complex_vector<F,L> twiddles(2);
+    heffte::stock::fill_level_twiddles<F,L>(25, 5, twiddles.data());
+    std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> fftForward = [&w51, &w52, &w53, &w54, &twiddles](complex_vector<F,L>& input, complex_vector<F,L>& output) {
+        heffte::stock::pow5_FFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::forward, w51, w52, w53, w54, twiddles.data());
+    };
+    std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> fftBackward = [&w51, &w52, &w53, &w54, &twiddles](complex_vector<F,L>& input, complex_vector<F,L>& output) {
+        heffte::stock::pow5_FFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::backward, w54, w53, w52, w51, twiddles.data());
+    };
+    std::function<void(complex_vector<F,L>&,complex_vector<F,L>&)> refForward = [](complex_vector<F,L>& input, complex_vector<F,L>& output) {
+        heffte::stock::DFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::forward);
+    };
+    // the longer size accumulates more rounding error in single precision
+    test_fft_template(25, fftForward, fftBackward, refForward, (is_float<F>::value) ? 0.1 : 1.0);
+}
+
+template<typename F>
+void test_stock_pow5_typed() {
+    current_test<F, using_nompi> name("stock FFT radix-5 test");
+    test_stock_pow5_template<F, 1>();
+#ifdef Heffte_ENABLE_AVX
+    test_stock_pow5_template<F, 4>();
+#endif
+#ifdef Heffte_ENABLE_AVX512
+    test_stock_pow5_template<F, is_float<F>::value? 16 : 8>();
+#endif
+}
+
+void test_stock_fft_pow5() {
+    test_stock_pow5_typed<float>();
+    test_stock_pow5_typed<double>();
+}
+
 // Represents the radix-p Fourier Transform
 template<typename F, int L>
-void test_stock_composite_template(int N) {
+void test_stock_composite_template(int N, double correction = 1.0) {
     using node_ptr = std::unique_ptr<stock::biFuncNode<F,L>[]>;
 
     int numNodes = stock::getNumNodes(N);
@@ -406,7 +452,7 @@ void test_stock_composite_template(int N) {
         heffte::stock::DFT_helper<F,L>(input.size(), input.data(), output.data(), 1, 1, heffte::direction::forward);
     };
 
-    test_fft_template(N, fftForward, fftBackward, refForward);
+    test_fft_template(N, fftForward, fftBackward, refForward, correction);
 }
 
 template<typename F>
@@ -414,13 +460,16 @@ void test_stock_composite_typed() {
     current_test<F, using_nompi> name("stock FFT composite size test");
     test_stock_composite_template<F,1>(1);
     test_stock_composite_template<F,1>(12);
+    test_stock_composite_template<F,1>(30, (is_float<F>::value) ? 0.1 : 1.0);
 #ifdef Heffte_ENABLE_AVX
     test_stock_composite_template<F, 4>(1);
     test_stock_composite_template<F, 4>(12);
+    test_stock_composite_template<F, 4>(30, (is_float<F>::value) ? 0.1 : 1.0);
 #endif
 #ifdef Heffte_ENABLE_AVX512
     test_stock_composite_template<F, is_float<F>::value? 16 : 8>(1);
     test_stock_composite_template<F, is_float<F>::value? 16 : 8>(12);
+    test_stock_composite_template<F, is_float<F>::value? 16 : 8>(30, (is_float<F>::value) ? 0.1 : 1.0);
 #endif
 }
 
@@ -438,6 +487,7 @@ int main(int, char**) {
     test_stock_fft_pow2();
     test_stock_fft_pow3();
     test_stock_fft_pow4();
+    test_stock_fft_pow5();
     test_stock_fft_composite();
 
     return 0;